@@ -3,11 +3,12 @@
 //===== By: ==================================================
 //= Ghost / Seabois
 //===== Current Version: =====================================
-//= 1.0
+//= 1.1
 //===== Description: =========================================
 //= Adds additional 0.01% drop rate to everything.
 //===== Changelog: ===========================================
 //= v1.0 - Initial Conversion
+//= v1.1 - Hook latency histograms (@pluginperf)
 //===== Additional Comments: =================================
 //= 
 //===== Repo Link: ===========================================
@@ -62,12 +63,13 @@
 #include <string.h>
 
 #include "plugins/HPMHooking.h"
+#include "pluginperf.h"
 #include "common/HPMDataCheck.h"
 
 HPExport struct hplugin_info pinfo = {
 	"AegisDropRate",		// Plugin name
 	SERVER_TYPE_MAP,// Which server types this plugin works with?
-	"1.0",			// Plugin version
+	"1.1",			// Plugin version
 	HPM_VERSION,	// HPM Version (don't change, macro is automatically updated)
 };
 
@@ -116,8 +118,26 @@ static unsigned int mob_drop_adjust_mine(int baserate, int rate_adjust, unsigned
 	return (unsigned int)cap_value(rate,rate_min,rate_max);
 }
 
+static struct pluginperf_histogram perf_mob_drop_adjust;
+
+static unsigned int mob_drop_adjust_probe(int baserate, int rate_adjust, unsigned short rate_min, unsigned short rate_max)
+{
+	unsigned int ret;
+
+	PLUGINPERF_TIME(perf_mob_drop_adjust, ret = mob_drop_adjust_mine(baserate, rate_adjust, rate_min, rate_max));
+	return ret;
+}
+
 HPExport void plugin_init(void) {
-	mob->drop_adjust = mob_drop_adjust_mine;
+	mob->drop_adjust = mob_drop_adjust_probe;
+
+	pluginperf_init(pinfo.name);
+	pluginperf_register(&perf_mob_drop_adjust, "mob->drop_adjust");
+}
+
+HPExport void plugin_final(void)
+{
+	pluginperf_dump();
 }
 
 HPExport void server_online(void)
@@ -3,13 +3,15 @@
 //===== By: ==================================================
 //= Ghost / Seabois
 //===== Current Version: =====================================
-//= 1.0
+//= 1.2
 //===== Description: =========================================
 //= Adds drop announce function based on items' drop rate.
 //= Set the variable "rate_announce" to whatever drop rate
 //= preferred. Eg. 10 if 0.1% and below.
 //===== Changelog: ===========================================
 //= v1.0 - Initial Conversion
+//= v1.1 - All drops of a kill are allocated at once
+//= v1.2 - Hook latency histograms (@pluginperf)
 //===== Additional Comments: =================================
 //= 
 //===== Repo Link: ===========================================
@@ -64,17 +66,20 @@
 #include <string.h>
 
 #include "plugins/HPMHooking.h"
+#include "pluginperf.h"
 #include "common/HPMDataCheck.h"
 
 
 
 #define MAX_ITEMRATIO_MOBS 10
 #define ERS_BLOCK_ENTRIES 2048
+// Most items one kill can drop: mob drops, Ore Discovery, bonus drops and the looted items.
+#define ITEM_DROP_BATCH_SIZE (MAX_MOB_DROP + 1 + MAX_PC_BONUS + LOOTITEM_SIZE)
 
 HPExport struct hplugin_info pinfo = {
 	"DropAnnounceRate",		// Plugin name
 	SERVER_TYPE_MAP,// Which server types this plugin works with?
-	"1.0",			// Plugin version
+	"1.2",			// Plugin version
 	HPM_VERSION,	// HPM Version (don't change, macro is automatically updated)
 };
 
@@ -87,7 +92,15 @@ struct item_drop_ratio {
 static struct item_drop_ratio *item_drop_ratio_db[MAX_ITEMDB];
 static struct DBMap *item_drop_ratio_other_db = NULL;
 
-static struct eri *item_drop_list_ers = NULL;
+// Drop list of one kill together with room for every item it can drop,
+// so a kill takes one allocation instead of one per item.
+struct item_drop_batch {
+	struct item_drop_list list; // Must be first, the release timer gets the batch as list
+	int count; // Used entries of items
+	struct item_drop items[ITEM_DROP_BATCH_SIZE];
+};
+
+static struct eri *item_drop_batch_ers = NULL;
 
 static struct mob_db *mob_db(int index)
 {
@@ -420,6 +433,102 @@ int64 apply_percentrate64(int64 value, int rate, int stdrate)
 
 
 
+static struct item_drop_batch *item_drop_batch_new(struct mob_data *md, struct map_session_data *first_sd, struct map_session_data *second_sd, struct map_session_data *third_sd)
+{
+	struct item_drop_batch *batch = ers_alloc(item_drop_batch_ers, struct item_drop_batch);
+
+	batch->list.m = md->bl.m;
+	batch->list.x = md->bl.x;
+	batch->list.y = md->bl.y;
+	batch->list.first_charid = (first_sd ? first_sd->status.char_id : 0);
+	batch->list.second_charid = (second_sd ? second_sd->status.char_id : 0);
+	batch->list.third_charid = (third_sd ? third_sd->status.char_id : 0);
+	batch->list.item = NULL;
+	batch->count = 0;
+	return batch;
+}
+
+// mob->setdropitem, filling the next free entry of the batch.
+static struct item_drop *item_drop_batch_setdropitem(struct item_drop_batch *batch, int nameid, struct optdrop_group *options, int qty, struct item_data *data)
+{
+	struct item_drop *drop;
+
+	if (batch->count >= ITEM_DROP_BATCH_SIZE)
+		return NULL;
+	drop = &batch->items[batch->count++];
+	memset(drop, 0, sizeof(*drop));
+	drop->item_data.nameid = nameid;
+	drop->item_data.amount = qty;
+	drop->item_data.identify = data ? itemdb->isidentified2(data) : itemdb->isidentified(nameid);
+	drop->showdropeffect = true;
+	mob->setdropitem_options(&drop->item_data, options);
+	return drop;
+}
+
+// mob->setlootitem, filling the next free entry of the batch.
+static struct item_drop *item_drop_batch_setlootitem(struct item_drop_batch *batch, struct item *item)
+{
+	struct item_drop *drop;
+
+	if (batch->count >= ITEM_DROP_BATCH_SIZE)
+		return NULL;
+	drop = &batch->items[batch->count++];
+	memcpy(&drop->item_data, item, sizeof(drop->item_data));
+	drop->showdropeffect = true;
+	drop->next = NULL;
+	return drop;
+}
+
+// mob->item_drop for batch entries: autolooted entries are simply left unlinked.
+static void item_drop_batch_add(struct mob_data *md, struct item_drop_batch *batch, struct item_drop *ditem, int loot, int drop_rate, unsigned short flag)
+{
+	struct item_drop_list *dlist = &batch->list;
+	struct map_session_data *sd;
+
+	if (ditem == NULL)
+		return;
+
+	//Logs items, dropped by mobs [Lupus]
+	logs->pick_mob(md, loot ? LOG_TYPE_LOOT : LOG_TYPE_PICKDROP_MONSTER, -ditem->item_data.amount, &ditem->item_data, NULL);
+
+	sd = map->charid2sd(dlist->first_charid);
+	if (sd == NULL)
+		sd = map->charid2sd(dlist->second_charid);
+	if (sd == NULL)
+		sd = map->charid2sd(dlist->third_charid);
+
+	if (sd != NULL
+	    && (drop_rate <= sd->state.autoloot || pc->isautolooting(sd, ditem->item_data.nameid))
+	    && (battle->bc->idle_no_autoloot == 0 || DIFF_TICK(sockt->last_tick, sd->idletime) < battle->bc->idle_no_autoloot)
+	    && (battle->bc->homunculus_autoloot ? 1 : !flag)
+#ifdef AUTOLOOT_DISTANCE
+	    && sd->bl.m == md->bl.m
+	    && check_distance_blxy(&sd->bl, dlist->x, dlist->y, AUTOLOOT_DISTANCE)
+#endif
+	   ) {
+		//Autoloot.
+		if (party->share_loot(party->search(sd->status.party_id), sd, &ditem->item_data, sd->status.char_id) == 0)
+			return;
+	}
+	ditem->next = dlist->item;
+	dlist->item = ditem;
+}
+
+// mob->delay_item_drop for a batch: puts its items on the floor and frees it in one go.
+static int item_drop_batch_release(int tid, int64 tick, int id, intptr_t data)
+{
+	struct item_drop_batch *batch = (struct item_drop_batch *)data;
+	struct item_drop *ditem;
+
+	for (ditem = batch->list.item; ditem != NULL; ditem = ditem->next) {
+		map->addflooritem(NULL, &ditem->item_data, ditem->item_data.amount,
+		    batch->list.m, batch->list.x, batch->list.y,
+		    batch->list.first_charid, batch->list.second_charid, batch->list.third_charid, 0, ditem->showdropeffect);
+	}
+	ers_free(item_drop_batch_ers, batch);
+	return 0;
+}
+
 static int mob_dead_mine(struct mob_data *md, struct block_list *src, int type)
 {
 	GUARD_MAP_LOCK
@@ -640,14 +749,7 @@ static int mob_dead_mine(struct mob_data *md, struct block_list *src, int type)
 		(md->special_state.ai == AI_SPHERE && battle->bc->alchemist_summon_reward == 1) //Marine Sphere Drops items.
 		) )
 	{ // Item Drop
-		if (item_drop_list_ers == NULL) {
-			item_drop_list_ers = ers_new(sizeof(struct item_drop_list), "plugin::item_drop_list_ers", ERS_OPT_NONE);
-			if (!item_drop_list_ers) {
-				printf("Failed to initialize item_drop_list_ers\n");
-				return;
-			}
-		}
-		struct item_drop_list *dlist = ers_alloc(item_drop_list_ers, struct item_drop_list);
+		struct item_drop_batch *batch = item_drop_batch_new(md, mvp_sd, second_sd, third_sd);
 		struct item_drop *ditem;
 		struct item_data* it = NULL;
 		int drop_rate;
@@ -659,14 +761,6 @@ static int mob_dead_mine(struct mob_data *md, struct block_list *src, int type)
 							100;/* no player was attached, we don't use any modifier (100 = rates are not touched) */
 #endif
 		
-		dlist->m = md->bl.m;
-		dlist->x = md->bl.x;
-		dlist->y = md->bl.y;
-		dlist->first_charid = (mvp_sd ? mvp_sd->status.char_id : 0);
-		dlist->second_charid = (second_sd ? second_sd->status.char_id : 0);
-		dlist->third_charid = (third_sd ? third_sd->status.char_id : 0);
-		dlist->item = NULL;
-		
 		for (i = 0; i < MAX_MOB_DROP; i++)
 		{
 			if (md->db->dropitem[i].nameid <= 0)
@@ -741,7 +835,7 @@ static int mob_dead_mine(struct mob_data *md, struct block_list *src, int type)
 				continue;
 			}
 
-			ditem = mob->setdropitem(md->db->dropitem[i].nameid, md->db->dropitem[i].options, 1, it);
+			ditem = item_drop_batch_setdropitem(batch, md->db->dropitem[i].nameid, md->db->dropitem[i].options, 1, it);
 			
 			// Official Drop Announce [Jedzkie]
 			if (mvp_sd != NULL) {
@@ -752,14 +846,14 @@ static int mob_dead_mine(struct mob_data *md, struct block_list *src, int type)
 
 			// Announce first, or else ditem will be freed. [Lance]
 			// By popular demand, use base drop rate for autoloot code. [Skotlex]
-			mob->item_drop(md, dlist, ditem, 0, battle->bc->autoloot_adjust ? drop_rate : md->db->dropitem[i].p, homkillonly);
+			item_drop_batch_add(md, batch, ditem, 0, battle->bc->autoloot_adjust ? drop_rate : md->db->dropitem[i].p, homkillonly);
 		}
 		
 		// Ore Discovery [Celest]
 		if (sd == mvp_sd && pc->checkskill(sd,BS_FINDINGORE) > 0) {
 			if( (temp = itemdb->chain_item(itemdb->chain_cache[ECC_ORE],&i)) ) {
-				ditem = mob->setdropitem(temp, NULL, 1, NULL);
-				mob->item_drop(md, dlist, ditem, 0, i, homkillonly);
+				ditem = item_drop_batch_setdropitem(batch, temp, NULL, 1, NULL);
+				item_drop_batch_add(md, batch, ditem, 0, i, homkillonly);
 			}
 		}
 
@@ -790,7 +884,7 @@ static int mob_dead_mine(struct mob_data *md, struct block_list *src, int type)
 						continue;
 					itemid = (!sd->add_drop[i].is_group) ? sd->add_drop[i].id : itemdb->chain_item(sd->add_drop[i].id, &drop_rate);
 					if( itemid )
-						mob->item_drop(md, dlist, mob->setdropitem(itemid, NULL, 1, NULL), 0, drop_rate, homkillonly);
+						item_drop_batch_add(md, batch, item_drop_batch_setdropitem(batch, itemid, NULL, 1, NULL), 0, drop_rate, homkillonly);
 				}
 			}
 
@@ -805,26 +899,22 @@ static int mob_dead_mine(struct mob_data *md, struct block_list *src, int type)
 		// process items looted by the mob
 		if(md->lootitem) {
 			for(i = 0; i < md->lootitem_count; i++)
-				mob->item_drop(md, dlist, mob->setlootitem(&md->lootitem[i]), 1, 10000, homkillonly);
+				item_drop_batch_add(md, batch, item_drop_batch_setlootitem(batch, &md->lootitem[i]), 1, 10000, homkillonly);
 		}
-		if (dlist->item) //There are drop items.
-			timer->add(tick + (!battle->bc->delay_battle_damage?500:0), mob->delay_item_drop, 0, (intptr_t)dlist);
+		if (batch->list.item) //There are drop items.
+			timer->add(tick + (!battle->bc->delay_battle_damage?500:0), item_drop_batch_release, 0, (intptr_t)batch);
 		else //No drops
-			ers_free(item_drop_list_ers, dlist);
+			ers_free(item_drop_batch_ers, batch);
 	} else if (md->lootitem && md->lootitem_count) {
 		//Loot MUST drop!
 		
-		struct item_drop_list *dlist = ers_alloc(item_drop_list_ers, struct item_drop_list);
-		dlist->m = md->bl.m;
-		dlist->x = md->bl.x;
-		dlist->y = md->bl.y;
-		dlist->first_charid = (mvp_sd ? mvp_sd->status.char_id : 0);
-		dlist->second_charid = (second_sd ? second_sd->status.char_id : 0);
-		dlist->third_charid = (third_sd ? third_sd->status.char_id : 0);
-		dlist->item = NULL;
+		struct item_drop_batch *batch = item_drop_batch_new(md, mvp_sd, second_sd, third_sd);
 		for(i = 0; i < md->lootitem_count; i++)
-			mob->item_drop(md, dlist, mob->setlootitem(&md->lootitem[i]), 1, 10000, homkillonly);
-		timer->add(tick + (!battle->bc->delay_battle_damage?500:0), mob->delay_item_drop, 0, (intptr_t)dlist);
+			item_drop_batch_add(md, batch, item_drop_batch_setlootitem(batch, &md->lootitem[i]), 1, 10000, homkillonly);
+		if (batch->list.item)
+			timer->add(tick + (!battle->bc->delay_battle_damage?500:0), item_drop_batch_release, 0, (intptr_t)batch);
+		else
+			ers_free(item_drop_batch_ers, batch);
 	}
 	
 	if(mvp_sd && md->db->mexp > 0 && md->special_state.ai == AI_NONE) {
@@ -1014,8 +1104,30 @@ static int mob_dead_mine(struct mob_data *md, struct block_list *src, int type)
 }
 
 
+static struct pluginperf_histogram perf_mob_dead;
+
+static int mob_dead_probe(struct mob_data *md, struct block_list *src, int type)
+{
+	int ret;
+
+	PLUGINPERF_TIME(perf_mob_dead, ret = mob_dead_mine(md, src, type));
+	return ret;
+}
+
 HPExport void plugin_init(void) {
-	mob->dead = mob_dead_mine;
+	mob->dead = mob_dead_probe;
+
+	pluginperf_init(pinfo.name);
+	pluginperf_register(&perf_mob_dead, "mob->dead");
+
+	item_drop_batch_ers = ers_new(sizeof(struct item_drop_batch), "dropannouncerate::item_drop_batch_ers", ERS_OPT_NONE);
+	timer->add_func_list(item_drop_batch_release, "item_drop_batch_release");
+}
+
+HPExport void plugin_final(void)
+{
+	pluginperf_dump();
+	ers_destroy(item_drop_batch_ers);
 }
 
 HPExport void server_online(void)
@@ -3,12 +3,21 @@
 //===== By: ==================================================
 //= Ghost / Seabois
 //===== Current Version: =====================================
-//= 1.0
+//= 1.9
 //===== Description: =========================================
 //= Looter mobs only pick up to 10 items, they will skip
 //= picking up items when full.
 //===== Changelog: ===========================================
 //= v1.0 - Initial Conversion
+//= v1.1 - AI-relevant statuses are tracked in a per-mob bitmask
+//= v1.2 - Cached can_reach results for rude-attack and chase checks
+//= v1.3 - Optional @aiprof branch counters for the hard AI (LOOTER_AI_PROFILE)
+//= v1.4 - Aggressive mobs skip target search in blocks without players
+//= v1.5 - Per-tick AI think budget, deferred mobs run first on the next tick
+//= v1.6 - Generation-checked target handles instead of an id2bl lookup per think
+//= v1.7 - Path searches towards a locked floor item are reused while nothing moved
+//= v1.8 - Looter inventories are saved at shutdown and given back when their spawn respawns
+//= v1.9 - Hook latency histograms (@pluginperf)
 //===== Additional Comments: =================================
 //= 
 //===== Repo Link: ===========================================
@@ -20,16 +29,20 @@
 #include "common/utils.h"
 #include "map/clif.h"
 #include "map/mob.h"
+#include "map/atcommand.h"
 #include "map/battle.h"
 #include "map/mapdefines.h"
 
 #include "map/log.h"
 #include "map/map.h"
+#include "map/path.h"
 #include "map/pc.h"
+#include "map/status.h"
 
 #include "common/HPMi.h"
 #include "common/cbasetypes.h"
 #include "common/conf.h"
+#include "common/db.h"
 #include "common/ers.h"
 #include "common/grfio.h"
 #include "common/memmgr.h"
@@ -49,7 +62,27 @@
 #include <stdarg.h>
 #include <time.h>
 
+#ifdef WIN32
+#include "common/winapi.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//#define LOOTER_AI_PROFILE // Uncomment to count hard AI exit paths per mob class and map, shown by @aiprof.
+
+#ifdef LOOTER_AI_PROFILE
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+#endif
+
 #include "plugins/HPMHooking.h"
+#include "pluginperf.h"
 #include "common/HPMDataCheck.h"
 
 #define ACTIVE_AI_RANGE 2 //Distance added on top of 'AREA_SIZE' at which mobs enter active AI mode.
@@ -70,40 +103,923 @@
 //Dynamic item drop ratio database for per-item drop ratio modifiers overriding global drop ratios.
 #define MAX_ITEMRATIO_MOBS 10
 
+// Statuses checked by the hard AI on every think, mirrored into a per-mob bitmask
+// from the status change hooks so the AI doesn't have to look each one up in sc.data[].
+enum mob_ai_inhibit {
+	AI_INHIBIT_DEEP_SLEEP     = 0x001,
+	AI_INHIBIT_BLADESTOP      = 0x002,
+	AI_INHIBIT_MANHOLE        = 0x004,
+	AI_INHIBIT_CURSEDCIRCLE   = 0x008,
+	AI_INHIBIT_BLIND          = 0x010,
+	AI_INHIBIT_SPIDERWEB      = 0x020, // The web may have burnt (val1 0), check it when set
+	AI_INHIBIT_WUGBITE        = 0x040,
+	AI_INHIBIT_VACUUM_EXTREME = 0x080,
+	AI_INHIBIT_THORNS_TRAP    = 0x100,
+	AI_INHIBIT_CHAOS          = 0x200,
+};
+
+// Statuses that stop the AI from thinking at all (besides opt1).
+#define AI_INHIBIT_ABNORMAL (AI_INHIBIT_DEEP_SLEEP|AI_INHIBIT_BLADESTOP|AI_INHIBIT_MANHOLE|AI_INHIBIT_CURSEDCIRCLE)
+// Statuses that keep a mob from reaching back at a rude attacker.
+#define AI_INHIBIT_TRAPPED (AI_INHIBIT_SPIDERWEB|AI_INHIBIT_WUGBITE|AI_INHIBIT_VACUUM_EXTREME|AI_INHIBIT_THORNS_TRAP|AI_INHIBIT_MANHOLE)
+
+#define REACH_CACHE_SIZE 2 // can_reach results remembered per mob (current target and attacker)
+#define REACH_CACHE_DURATION 1000 // How long (ms) a can_reach result is reused for the same cells.
+#define REACH_CACHE_REPORT_INTERVAL (10*60*1000) // How often the cache hit rate is shown on the console.
+#define LOOT_PATH_CACHE_SIZE 4 // path->search results remembered per loot target (reachability checks and the walk itself)
+
+// Unit types a plain mob could pick as target. Mobs only count while summoned or in a battleground.
+#define OCCUPANCY_TYPES (BL_PC|BL_HOM|BL_MER|BL_ELEM)
+
+#define LOOT_SNAPSHOT_MAGIC "LNDL"
+#define LOOT_SNAPSHOT_VERSION 1
+
+#define AIPROF_RING_SIZE 60 // Seconds of per-path totals kept for @aiprof.
+#define AIPROF_TOP_ENTRIES 5 // Mob class/map pairs listed by @aiprof.
+
+// Exit path taken by a hard AI think.
+enum mob_ai_path {
+	AIPATH_SKIP,           // Not thinking this tick (think interval, casting, not on a map)
+	AIPATH_DEFERRED,       // Think budget of this tick used up
+	AIPATH_ABNORMAL,       // Stopped by opt1 or an inhibiting status
+	AIPATH_TARGET_INVALID, // Kept chasing an invalid target
+	AIPATH_RUDE_ESCAPE,
+	AIPATH_SLAVE,
+	AIPATH_LOOT_WALK,
+	AIPATH_LOOT_PICKUP,
+	AIPATH_ATTACK,
+	AIPATH_CHASE,
+	AIPATH_UNLOCK,         // No target, or the target was dropped
+	AIPATH_MAX
+};
+
+#ifdef LOOTER_AI_PROFILE
+#define AI_RETURN(path, ret) do { aiprof_path = (path); return (ret); } while (0)
+#else
+#define AI_RETURN(path, ret) return (ret)
+#endif
+
 HPExport struct hplugin_info pinfo = {
 	"LooterNoDelete",		// Plugin name
 	SERVER_TYPE_MAP,// Which server types this plugin works with?
-	"1.0",			// Plugin version
+	"1.9",			// Plugin version
 	HPM_VERSION,	// HPM Version (don't change, macro is automatically updated)
 };
 
-static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
+// A remembered mob->can_reach result. It is only reused while neither the
+// mob nor the target has moved, no map cell was changed and it hasn't expired.
+struct mob_reach_cache {
+	int target_id; // 0 if unused
+	int16 m, x, y; // Mob position
+	int16 tx, ty;  // Target position
+	int range;
+	int state;
+	int64 tick;
+	uint32 cell_generation;
+	bool result;
+};
+
+// A remembered map->id2bl result. The pointer is trusted while the generation of its
+// kind is unchanged, i.e. no object of that kind has left the ID database since.
+struct ai_target_handle {
+	int id;
+	struct block_list *bl; // NULL if unused
+	bool transient;        // Floor item or skill unit
+	uint32 generation;
+};
+
+// A remembered path->search made while walking to a floor item.
+struct mob_loot_path {
+	int16 m, x0, y0, x1, y1;
+	int flag;
+	cell_chk cell;
+	bool has_path; // wpd was filled in, false for searches that only checked reachability
+	bool result;
+	struct walkpath_data wpd;
+};
+
+// Per-mob AI state, attached through HPM mob data.
+struct mob_ai_data {
+	uint32 inhibit; // AI_INHIBIT_* flags of the statuses currently active
+	struct mob_reach_cache reach[REACH_CACHE_SIZE];
+	int reach_next; // Slot replaced next when no slot holds the target
+	bool occupancy; // Counted in its map's occupancy grid
+	uint32 sched_seq; // Queue entry of the think scheduler it waits in, 0 when not waiting
+	struct ai_target_handle target, attacker;
+	int loot_id; // Floor item the remembered paths lead to
+	uint32 loot_cell_generation;
+	struct mob_loot_path loot_path[LOOT_PATH_CACHE_SIZE];
+	int loot_path_count;
+	int loot_path_next; // Slot replaced next once all are used
+};
+
+// Start of the looter inventory snapshot.
+struct loot_snapshot_header {
+	char magic[4]; // LOOT_SNAPSHOT_MAGIC
+	uint32 version;
+	uint32 item_size; // sizeof(struct item) of the server that wrote the file
+	uint32 records;
+};
+
+// One looter in the snapshot, followed by `count` struct item.
+// Everything before `count` identifies the spawn the looter belongs to.
+struct loot_snapshot_record {
+	char mapname[MAP_NAME_LENGTH];
+	int16 x, y, xs, ys;
+	int16 class_;
+	uint16 count;
+};
+
+// Snapshot record waiting for a mob of its spawn, sorted by hash.
+struct loot_snapshot_entry {
+	uint32 hash;
+	bool claimed;
+	size_t offset; // Of the record in the snapshot
+};
+
+// Per-map count of possible targets in each block, kept up to date from map->addblock/delblock.
+struct map_occupancy {
+	int16 bxs, bys;
+	int total;
+	uint16 *count; // bxs * bys entries, NULL until something is counted on the map
+};
+
+static struct map_occupancy *map_occupancy = NULL; // One entry per map
+static int map_occupancy_size = 0;
+static bool map_occupancy_adding = false; // Set by the addblock pre-hook when the block will be linked
+
+// Time (microseconds) all hard AI thinks of one mob->ai_hard tick may use.
+// Mobs over budget wait for the next tick, where they run before anything else. 0 disables.
+int ai_think_budget = 20000;
+
+// File the looter inventories are saved to at shutdown. Read and removed again at startup,
+// so a crash can't hand out the same items twice.
+const char *loot_snapshot_file = "log/looternodelete_loot.bin";
+
+static const unsigned char *loot_snapshot = NULL; // Snapshot read at startup, NULL once every record was given back
+static size_t loot_snapshot_size = 0;
+static struct loot_snapshot_entry *loot_snapshot_index = NULL;
+static int loot_snapshot_count = 0;
+static int loot_snapshot_claimed = 0;
+
+// A mob that was over the think budget, ordered by urgency and then by how long it has waited.
+struct ai_sched_entry {
+	int id;
+	uint32 seq; // Stale once the mob's sched_seq differs (it thought, or the ID was reused)
+	int64 since; // last_thinktime when it was deferred
+	int64 tick; // Tick it was deferred on
+	bool urgent; // Had a target or was attacked
+};
+
+static struct ai_sched_entry *ai_sched_queue = NULL; // Binary heap
+static int ai_sched_len = 0;
+static int ai_sched_max = 0;
+static int64 ai_sched_start = 0; // Clock at the start of the current tick
+static bool ai_sched_in_tick = false; // Inside mob->ai_hard; thinks from other timers are never deferred
+static uint32 ai_sched_seq = 0;
+
+static struct {
+	unsigned int ticks;      // Ticks that ran over budget
+	unsigned int deferred;   // Mobs pushed to a later tick
+	unsigned int ran;        // Deferred thinks that ran later
+	int64 lateness;          // Sum of how late (ms) those ran
+	int64 max_lateness;
+} ai_sched_stats;
+static int64 ai_sched_last_over = -1; // Tick that was last counted in ai_sched_stats.ticks
+
+// Bumped when an object leaves the ID database. Floor items and skill units come and go
+// far more often than units, so they have their own generation.
+static uint32 ai_unit_generation = 0;
+static uint32 ai_transient_generation = 0;
+
+// Bumped whenever a map cell changes, which invalidates every cached path result.
+static uint32 map_cell_generation = 0;
+
+static unsigned int reach_cache_hits = 0;
+static unsigned int reach_cache_lookups = 0;
+
+static struct mob_ai_data *loot_path_owner = NULL; // Set while a looter walks to its loot target
+static unsigned int loot_path_hits = 0;
+static unsigned int loot_path_searches = 0;
+
+#ifdef LOOTER_AI_PROFILE
+struct aiprof_counter {
+	uint64 count;
+	uint64 cycles;
+};
+
+// Totals of one mob class on one map since the last reset.
+struct aiprof_entry {
+	int16 m;
+	int class_;
+	struct aiprof_counter path[AIPATH_MAX];
+};
+
+static const char *aiprof_path_name[AIPATH_MAX] = {
+	"skip", "deferred", "abnormal", "target invalid", "rude escape", "slave",
+	"loot walk", "loot pickup", "attack", "chase", "unlock",
+};
+
+static struct DBMap *aiprof_db = NULL; // (m << 16 | class_) -> struct aiprof_entry
+static struct aiprof_counter aiprof_second[AIPATH_MAX]; // Current second
+static struct aiprof_counter aiprof_ring[AIPROF_RING_SIZE][AIPATH_MAX]; // Last AIPROF_RING_SIZE seconds
+static int aiprof_ring_pos = 0;
+static int aiprof_ring_len = 0;
+static enum mob_ai_path aiprof_path = AIPATH_SKIP; // Set by AI_RETURN
+
+static inline uint64 aiprof_cycles(void)
+{
+#if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static void aiprof_record(struct mob_data *md, enum mob_ai_path path, uint64 cycles)
+{
+	struct aiprof_entry *entry;
+	int key;
+
+	aiprof_second[path].count++;
+	aiprof_second[path].cycles += cycles;
+
+	if (md == NULL || md->bl.m < 0)
+		return;
+
+	key = (md->bl.m << 16) | (md->class_ & 0xFFFF);
+	if ((entry = idb_get(aiprof_db, key)) == NULL) {
+		CREATE(entry, struct aiprof_entry, 1);
+		entry->m = md->bl.m;
+		entry->class_ = md->class_;
+		idb_put(aiprof_db, key, entry);
+	}
+	entry->path[path].count++;
+	entry->path[path].cycles += cycles;
+}
+
+// Moves the current second's totals into the ring buffer.
+static int aiprof_rotate(int tid, int64 tick, int id, intptr_t data)
+{
+	memcpy(aiprof_ring[aiprof_ring_pos], aiprof_second, sizeof(aiprof_second));
+	memset(aiprof_second, 0, sizeof(aiprof_second));
+	aiprof_ring_pos = (aiprof_ring_pos + 1) % AIPROF_RING_SIZE;
+	if (aiprof_ring_len < AIPROF_RING_SIZE)
+		aiprof_ring_len++;
+	return 0;
+}
+
+static uint64 aiprof_entry_cycles(const struct aiprof_entry *entry)
+{
+	uint64 cycles = 0;
+	int i;
+
+	for (i = 0; i < AIPATH_MAX; i++)
+		cycles += entry->path[i].cycles;
+	return cycles;
+}
+
+/*==========================================
+ * @aiprof [reset]
+ * Shows where hard AI time went over the last minute.
+ *------------------------------------------*/
+ACMD(aiprof)
+{
+	struct aiprof_counter total[AIPATH_MAX] = { { 0 } };
+	const struct aiprof_entry *top[AIPROF_TOP_ENTRIES] = { NULL };
+	struct DBIterator *iter;
+	struct aiprof_entry *entry;
+	char output[CHAT_SIZE_MAX];
+	int i, j;
+
+	if (*message != '\0' && strcmpi(message, "reset") == 0) {
+		db_clear(aiprof_db);
+		memset(aiprof_ring, 0, sizeof(aiprof_ring));
+		memset(aiprof_second, 0, sizeof(aiprof_second));
+		aiprof_ring_pos = aiprof_ring_len = 0;
+		clif->message(fd, "AI profile counters have been reset.");
+		return true;
+	}
+
+	if (aiprof_ring_len == 0) {
+		clif->message(fd, "No AI profile data yet, try again in a second.");
+		return true;
+	}
+
+	for (i = 0; i < aiprof_ring_len; i++) {
+		for (j = 0; j < AIPATH_MAX; j++) {
+			total[j].count += aiprof_ring[i][j].count;
+			total[j].cycles += aiprof_ring[i][j].cycles;
+		}
+	}
+
+	snprintf(output, sizeof(output), "------ Hard AI paths, last %d seconds ------", aiprof_ring_len);
+	clif->message(fd, output);
+	for (j = 0; j < AIPATH_MAX; j++) {
+		if (total[j].count == 0)
+			continue;
+		snprintf(output, sizeof(output), "%s: %"PRIu64" thinks/s, %"PRIu64" cycles/think",
+			aiprof_path_name[j], total[j].count / aiprof_ring_len, total[j].cycles / total[j].count);
+		clif->message(fd, output);
+	}
+
+	iter = db_iterator(aiprof_db);
+	for (entry = dbi_first(iter); dbi_exists(iter); entry = dbi_next(iter)) {
+		uint64 cycles = aiprof_entry_cycles(entry);
+
+		ARR_FIND(0, AIPROF_TOP_ENTRIES, i, top[i] == NULL || aiprof_entry_cycles(top[i]) < cycles);
+		if (i == AIPROF_TOP_ENTRIES)
+			continue;
+		memmove(&top[i + 1], &top[i], (AIPROF_TOP_ENTRIES - i - 1) * sizeof(top[0]));
+		top[i] = entry;
+	}
+	dbi_destroy(iter);
+
+	clif->message(fd, "------ Most expensive mobs since reset ------");
+	for (i = 0; i < AIPROF_TOP_ENTRIES && top[i] != NULL; i++) {
+		uint64 thinks = 0;
+
+		for (j = 0; j < AIPATH_MAX; j++)
+			thinks += top[i]->path[j].count;
+		snprintf(output, sizeof(output), "%s (%d) on %s: %"PRIu64" thinks, %"PRIu64" cycles",
+			mob->db(top[i]->class_)->jname, top[i]->class_, map->list[top[i]->m].name, thinks, aiprof_entry_cycles(top[i]));
+		clif->message(fd, output);
+	}
+	return true;
+}
+#endif // LOOTER_AI_PROFILE
+
+static struct mob_ai_data *mob_ai_data(struct mob_data *md, bool create)
+{
+	struct mob_ai_data *ad = getFromMOBDATA(md, 0);
+
+	if (ad == NULL && create) {
+		CREATE(ad, struct mob_ai_data, 1);
+		addToMOBDATA(md, ad, 0, true);
+	}
+	return ad;
+}
+
+static uint32 mob_ai_sc2inhibit(enum sc_type type)
+{
+	switch (type) {
+		case SC_DEEP_SLEEP:           return AI_INHIBIT_DEEP_SLEEP;
+		case SC_BLADESTOP:            return AI_INHIBIT_BLADESTOP;
+		case SC__MANHOLE:             return AI_INHIBIT_MANHOLE;
+		case SC_CURSEDCIRCLE_TARGET:  return AI_INHIBIT_CURSEDCIRCLE;
+		case SC_BLIND:                return AI_INHIBIT_BLIND;
+		case SC_SPIDERWEB:            return AI_INHIBIT_SPIDERWEB;
+		case SC_WUGBITE:              return AI_INHIBIT_WUGBITE;
+		case SC_VACUUM_EXTREME:       return AI_INHIBIT_VACUUM_EXTREME;
+		case SC_THORNS_TRAP:          return AI_INHIBIT_THORNS_TRAP;
+		case SC__CHAOS:               return AI_INHIBIT_CHAOS;
+		default:                      return 0;
+	}
+}
+
+// Re-reads the status entry so that a failed start is reflected too.
+static void mob_ai_update_inhibit(struct mob_data *md, enum sc_type type)
+{
+	const struct status_change_entry *sce;
+	struct mob_ai_data *ad;
+	uint32 flag = mob_ai_sc2inhibit(type);
+	bool active;
+
+	if (flag == 0)
+		return;
+
+	sce = md->sc.data[type];
+	active = (sce != NULL);
+	if ((ad = mob_ai_data(md, active)) == NULL)
+		return; // Nothing was ever set on this mob
+
+	if (active)
+		ad->inhibit |= flag;
+	else
+		ad->inhibit &= ~flag;
+}
+
+// map->id2bl that skips the ID database lookup while the remembered pointer is still valid.
+static struct block_list *ai_handle_get(struct ai_target_handle *h, int id)
+{
+	if (h->bl != NULL && h->id == id
+	 && h->generation == (h->transient ? ai_transient_generation : ai_unit_generation))
+		return h->bl;
+
+	h->id = id;
+	if ((h->bl = map->id2bl(id)) != NULL) {
+		h->transient = (h->bl->type&(BL_ITEM|BL_SKILL)) != 0;
+		h->generation = h->transient ? ai_transient_generation : ai_unit_generation;
+	}
+	return h->bl;
+}
+
+static void map_deliddb_pre(struct block_list **bl)
+{
+	if (*bl == NULL)
+		return;
+	if (((*bl)->type&(BL_ITEM|BL_SKILL)) != 0)
+		ai_transient_generation++;
+	else
+		ai_unit_generation++;
+}
+
+// mob->can_reach with a short-lived per-mob cache, so a mob failing to reach
+// the same target doesn't re-run the path search on every think.
+static bool mob_can_reach_cached(struct mob_data *md, struct block_list *bl, int range, int state, int64 tick)
+{
+	struct mob_ai_data *ad;
+	struct mob_reach_cache *rc = NULL;
+	int i;
+
+	if (bl == NULL)
+		return mob->can_reach(md, bl, range, state);
+
+	ad = mob_ai_data(md, true);
+	reach_cache_lookups++;
+
+	for (i = 0; i < REACH_CACHE_SIZE; i++) {
+		if (ad->reach[i].target_id == bl->id) {
+			rc = &ad->reach[i];
+			break;
+		}
+	}
+
+	if (rc != NULL) {
+		if (rc->m == md->bl.m && rc->x == md->bl.x && rc->y == md->bl.y
+		 && rc->tx == bl->x && rc->ty == bl->y
+		 && rc->range == range && rc->state == state
+		 && rc->cell_generation == map_cell_generation
+		 && DIFF_TICK(tick, rc->tick) < REACH_CACHE_DURATION) {
+			reach_cache_hits++;
+			return rc->result;
+		}
+	} else {
+		rc = &ad->reach[ad->reach_next];
+		ad->reach_next = (ad->reach_next + 1) % REACH_CACHE_SIZE;
+	}
+
+	rc->target_id = bl->id;
+	rc->m = md->bl.m;
+	rc->x = md->bl.x;
+	rc->y = md->bl.y;
+	rc->tx = bl->x;
+	rc->ty = bl->y;
+	rc->range = range;
+	rc->state = state;
+	rc->tick = tick;
+	rc->cell_generation = map_cell_generation;
+	rc->result = mob->can_reach(md, bl, range, state);
+	return rc->result;
+}
+
+// unit->walk_tobl towards a floor item. The path searches it makes are remembered
+// with the loot target and reused while the mob, the item and the map cells stay the same.
+static int mob_walk_toloot(struct mob_data *md, struct block_list *tbl)
+{
+	struct mob_ai_data *ad = mob_ai_data(md, true);
+	int ret;
+
+	if (ad->loot_id != tbl->id || ad->loot_cell_generation != map_cell_generation) {
+		ad->loot_id = tbl->id;
+		ad->loot_cell_generation = map_cell_generation;
+		ad->loot_path_count = 0;
+		ad->loot_path_next = 0;
+	}
+
+	loot_path_owner = ad;
+	ret = unit->walk_tobl(&md->bl, tbl, 1, 1);
+	loot_path_owner = NULL;
+	return ret;
+}
+
+static bool path_search_pre(struct walkpath_data **wpd, struct block_list **bl, int16 *m, int16 *x0, int16 *y0, int16 *x1, int16 *y1, int *flag, cell_chk *cell)
+{
+	int i;
+
+	if (loot_path_owner == NULL)
+		return false;
+
+	loot_path_searches++;
+	for (i = 0; i < loot_path_owner->loot_path_count; i++) {
+		const struct mob_loot_path *lp = &loot_path_owner->loot_path[i];
+
+		if (lp->m != *m || lp->x0 != *x0 || lp->y0 != *y0 || lp->x1 != *x1 || lp->y1 != *y1
+		 || lp->flag != *flag || lp->cell != *cell || (*wpd != NULL && !lp->has_path))
+			continue;
+
+		if (*wpd != NULL && lp->result)
+			memcpy(*wpd, &lp->wpd, sizeof(**wpd));
+		loot_path_hits++;
+		hookStop();
+		return lp->result;
+	}
+	return false;
+}
+
+static bool path_search_post(bool retVal, struct walkpath_data *wpd, struct block_list *bl, int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int flag, cell_chk cell)
+{
+	struct mob_loot_path *lp;
+
+	if (loot_path_owner == NULL)
+		return retVal;
+
+	if (loot_path_owner->loot_path_count < LOOT_PATH_CACHE_SIZE) {
+		lp = &loot_path_owner->loot_path[loot_path_owner->loot_path_count++];
+	} else {
+		lp = &loot_path_owner->loot_path[loot_path_owner->loot_path_next];
+		loot_path_owner->loot_path_next = (loot_path_owner->loot_path_next + 1) % LOOT_PATH_CACHE_SIZE;
+	}
+
+	lp->m = m;
+	lp->x0 = x0;
+	lp->y0 = y0;
+	lp->x1 = x1;
+	lp->y1 = y1;
+	lp->flag = flag;
+	lp->cell = cell;
+	lp->has_path = (wpd != NULL);
+	lp->result = retVal;
+	if (wpd != NULL && retVal)
+		memcpy(&lp->wpd, wpd, sizeof(lp->wpd));
+	return retVal;
+}
+
+static int mob_reach_cache_report(int tid, int64 tick, int id, intptr_t data)
+{
+	if (reach_cache_lookups > 0) {
+		ShowInfo("%s: can_reach cache hit %u of %u lookups (%.1f%%) in the last %d minutes.\n",
+			pinfo.name, reach_cache_hits, reach_cache_lookups,
+			reach_cache_hits * 100. / reach_cache_lookups, REACH_CACHE_REPORT_INTERVAL / 60000);
+		reach_cache_hits = reach_cache_lookups = 0;
+	}
+	if (loot_path_searches > 0) {
+		ShowInfo("%s: loot path cache hit %u of %u path searches (%.1f%%) in the last %d minutes.\n",
+			pinfo.name, loot_path_hits, loot_path_searches,
+			loot_path_hits * 100. / loot_path_searches, REACH_CACHE_REPORT_INTERVAL / 60000);
+		loot_path_hits = loot_path_searches = 0;
+	}
+	return 0;
+}
+
+static void map_setcell_post(int16 m, int16 x, int16 y, cell_t cell, bool flag)
+{
+	map_cell_generation++;
+}
+
+static void map_setgatcell_post(int16 m, int16 x, int16 y, int gat)
+{
+	map_cell_generation++;
+}
+
+static struct map_occupancy *map_occupancy_get(int16 m)
+{
+	struct map_occupancy *mo;
+
+	if (m >= map_occupancy_size) {
+		RECREATE(map_occupancy, struct map_occupancy, map->count);
+		memset(map_occupancy + map_occupancy_size, 0, (map->count - map_occupancy_size) * sizeof(*map_occupancy));
+		map_occupancy_size = map->count;
+	}
+
+	mo = &map_occupancy[m];
+	if (mo->bxs != map->list[m].bxs || mo->bys != map->list[m].bys) {
+		// Not used yet, or the map slot was reused by an instance of another size.
+		aFree(mo->count);
+		mo->bxs = map->list[m].bxs;
+		mo->bys = map->list[m].bys;
+		mo->total = 0;
+		CREATE(mo->count, uint16, mo->bxs * mo->bys);
+	}
+	return mo;
+}
+
+static void map_occupancy_update(struct block_list *bl, int value)
+{
+	struct map_occupancy *mo;
+
+	if (bl->type == BL_MOB) {
+		struct mob_data *md = BL_UCAST(BL_MOB, bl);
+		struct mob_ai_data *ad;
+
+		if (value > 0) {
+			if (md->special_state.ai == AI_NONE && md->bg_id == 0)
+				return;
+			ad = mob_ai_data(md, true);
+			if (ad->occupancy)
+				return;
+			ad->occupancy = true;
+		} else {
+			if ((ad = mob_ai_data(md, false)) == NULL || !ad->occupancy)
+				return;
+			ad->occupancy = false;
+		}
+	} else if ((bl->type&OCCUPANCY_TYPES) == 0) {
+		return;
+	}
+
+	if (bl->m < 0 || bl->m >= map->count)
+		return;
+	mo = map_occupancy_get(bl->m);
+	mo->count[bl->x / BLOCK_SIZE + (bl->y / BLOCK_SIZE) * mo->bxs] += value;
+	mo->total += value;
+}
+
+// Counts possible targets in the blocks covering 'range' cells around (x, y) and
+// narrows the area to the occupied blocks, so the search can skip empty ones.
+static int map_occupancy_area(int16 m, int16 x, int16 y, int range, int16 *x0, int16 *y0, int16 *x1, int16 *y1)
+{
+	const struct map_occupancy *mo;
+	int bx, by, bx0, by0, bx1, by1;
+	int minbx = INT_MAX, minby = INT_MAX, maxbx = -1, maxby = -1;
+	int total = 0;
+
+	if (m < 0 || m >= map_occupancy_size || map_occupancy[m].total <= 0 || map_occupancy[m].count == NULL)
+		return 0;
+	mo = &map_occupancy[m];
+
+	*x0 = max(x - range, 0);
+	*y0 = max(y - range, 0);
+	*x1 = min(x + range, map->list[m].xs - 1);
+	*y1 = min(y + range, map->list[m].ys - 1);
+	bx0 = *x0 / BLOCK_SIZE;
+	by0 = *y0 / BLOCK_SIZE;
+	bx1 = min(*x1 / BLOCK_SIZE, mo->bxs - 1);
+	by1 = min(*y1 / BLOCK_SIZE, mo->bys - 1);
+
+	for (by = by0; by <= by1; by++) {
+		for (bx = bx0; bx <= bx1; bx++) {
+			int count = mo->count[bx + by * mo->bxs];
+
+			if (count == 0)
+				continue;
+			total += count;
+			minbx = min(minbx, bx);
+			maxbx = max(maxbx, bx);
+			minby = min(minby, by);
+			maxby = max(maxby, by);
+		}
+	}
+
+	if (total > 0) {
+		*x0 = max(*x0, minbx * BLOCK_SIZE);
+		*y0 = max(*y0, minby * BLOCK_SIZE);
+		*x1 = min(*x1, maxbx * BLOCK_SIZE + BLOCK_SIZE - 1);
+		*y1 = min(*y1, maxby * BLOCK_SIZE + BLOCK_SIZE - 1);
+	}
+	return total;
+}
+
+static int map_addblock_pre(struct block_list **bl)
+{
+	struct block_list *b = *bl;
+
+	// Same checks map->addblock does before linking the block.
+	map_occupancy_adding = (b != NULL && b->prev == NULL && b->m >= 0 && b->m < map->count
+		&& b->x >= 0 && b->x < map->list[b->m].xs && b->y >= 0 && b->y < map->list[b->m].ys);
+	return 0;
+}
+
+static int map_addblock_post(int retVal, struct block_list *bl)
+{
+	if (map_occupancy_adding && retVal == 0)
+		map_occupancy_update(bl, 1);
+	map_occupancy_adding = false;
+	return retVal;
+}
+
+static int map_delblock_pre(struct block_list **bl)
+{
+	if (*bl != NULL && (*bl)->prev != NULL)
+		map_occupancy_update(*bl, -1);
+	return 0;
+}
+
+static int64 ai_sched_clock(void)
+{
+#ifdef WIN32
+	LARGE_INTEGER freq, now;
+
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+	return (int64)(now.QuadPart * 1000000 / freq.QuadPart);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+// Whether a should run before b.
+static inline bool ai_sched_before(const struct ai_sched_entry *a, const struct ai_sched_entry *b)
+{
+	if (a->urgent != b->urgent)
+		return a->urgent;
+	return DIFF_TICK(a->since, b->since) < 0;
+}
+
+static void ai_sched_push(const struct ai_sched_entry *entry)
+{
+	int i;
+
+	if (ai_sched_len == ai_sched_max) {
+		ai_sched_max = ai_sched_max ? ai_sched_max * 2 : 256;
+		RECREATE(ai_sched_queue, struct ai_sched_entry, ai_sched_max);
+	}
+
+	for (i = ai_sched_len++; i > 0 && ai_sched_before(entry, &ai_sched_queue[(i - 1) / 2]); i = (i - 1) / 2)
+		ai_sched_queue[i] = ai_sched_queue[(i - 1) / 2];
+	ai_sched_queue[i] = *entry;
+}
+
+static void ai_sched_pop(struct ai_sched_entry *out)
+{
+	struct ai_sched_entry last;
+	int i = 0;
+
+	*out = ai_sched_queue[0];
+	last = ai_sched_queue[--ai_sched_len];
+	while (i * 2 + 1 < ai_sched_len) {
+		int child = i * 2 + 1;
+
+		if (child + 1 < ai_sched_len && ai_sched_before(&ai_sched_queue[child + 1], &ai_sched_queue[child]))
+			child++;
+		if (!ai_sched_before(&ai_sched_queue[child], &last))
+			break;
+		ai_sched_queue[i] = ai_sched_queue[child];
+		i = child;
+	}
+	ai_sched_queue[i] = last;
+}
+
+// Defers the think when this mob->ai_hard tick's budget is used up.
+static bool ai_sched_defer(struct mob_data *md, int64 tick)
+{
+	struct mob_ai_data *ad;
+
+	if (!ai_sched_in_tick || ai_think_budget <= 0 || ai_sched_clock() - ai_sched_start < ai_think_budget) {
+		// Thinks now, so its queue entry (if any) goes stale
+		if (ai_sched_len > 0 && (ad = mob_ai_data(md, false)) != NULL)
+			ad->sched_seq = 0;
+		return false;
+	}
+
+	if (ai_sched_last_over != tick) {
+		ai_sched_last_over = tick;
+		ai_sched_stats.ticks++;
+	}
+
+	// A mob near several players is visited once for each of them
+	ad = mob_ai_data(md, true);
+	if (ad->sched_seq == 0) {
+		struct ai_sched_entry entry = { md->bl.id, 0, md->last_thinktime, tick, (md->target_id != 0 || md->attacked_id != 0) };
+
+		if (++ai_sched_seq == 0)
+			ai_sched_seq = 1;
+		entry.seq = ad->sched_seq = ai_sched_seq;
+		ai_sched_push(&entry);
+		ai_sched_stats.deferred++;
+	}
+	return true;
+}
+
+// Starts the think budget of a new tick and runs the mobs left over from the previous ones first.
+static int mob_ai_hard_pre(int *tid, int64 *tick, int *id, intptr_t *data)
+{
+	ai_sched_start = ai_sched_clock();
+	ai_sched_in_tick = true;
+
+	while (ai_sched_len > 0 && (ai_think_budget <= 0 || ai_sched_clock() - ai_sched_start < ai_think_budget)) {
+		struct ai_sched_entry entry;
+		struct mob_data *md;
+		struct mob_ai_data *ad;
+		int64 late;
+
+		ai_sched_pop(&entry);
+		if ((md = map->id2md(entry.id)) == NULL || (ad = mob_ai_data(md, false)) == NULL || ad->sched_seq != entry.seq)
+			continue;
+		ad->sched_seq = 0;
+
+		late = DIFF_TICK(*tick, entry.tick);
+		ai_sched_stats.ran++;
+		ai_sched_stats.lateness += late;
+		ai_sched_stats.max_lateness = max(ai_sched_stats.max_lateness, late);
+
+		// Same as mob->ai_sub_hard_timer does for mobs near players.
+		if (mob->ai_sub_hard(md, *tick)) {
+			md->state.spotted = 1;
+			md->last_pcneartime = *tick;
+		}
+	}
+	return 0;
+}
+
+static int mob_ai_hard_post(int retVal, int tid, int64 tick, int id, intptr_t data)
+{
+	ai_sched_in_tick = false;
+	return retVal;
+}
+
+// Mobs still waiting in the queue, skipping the entries of those that thought since.
+static int ai_sched_waiting(void)
+{
+	int i, count = 0;
+
+	for (i = 0; i < ai_sched_len; i++) {
+		struct mob_data *md = map->id2md(ai_sched_queue[i].id);
+		struct mob_ai_data *ad;
+
+		if (md != NULL && (ad = mob_ai_data(md, false)) != NULL && ad->sched_seq == ai_sched_queue[i].seq)
+			count++;
+	}
+	return count;
+}
+
+/*==========================================
+ * @aisched [reset]
+ * Shows how often and how late the think budget deferred mobs.
+ *------------------------------------------*/
+ACMD(aisched)
+{
+	char output[CHAT_SIZE_MAX];
+
+	if (*message != '\0' && strcmpi(message, "reset") == 0) {
+		memset(&ai_sched_stats, 0, sizeof(ai_sched_stats));
+		clif->message(fd, "AI scheduler counters have been reset.");
+		return true;
+	}
+
+	snprintf(output, sizeof(output), "Think budget: %d us per tick, %d mobs waiting.", ai_think_budget, ai_sched_waiting());
+	clif->message(fd, output);
+	snprintf(output, sizeof(output), "Ticks over budget: %u, deferred mobs: %u, ran later: %u.",
+		ai_sched_stats.ticks, ai_sched_stats.deferred, ai_sched_stats.ran);
+	clif->message(fd, output);
+	if (ai_sched_stats.ran > 0) {
+		snprintf(output, sizeof(output), "Lateness: %"PRId64" ms average, %"PRId64" ms max.",
+			ai_sched_stats.lateness / ai_sched_stats.ran, ai_sched_stats.max_lateness);
+		clif->message(fd, output);
+	}
+	return true;
+}
+
+static int status_change_start_post(int retVal, struct block_list *src, struct block_list *bl, enum sc_type type, int rate, int val1, int val2, int val3, int val4, int total_tick, int flag, int skill_id)
+{
+	struct mob_data *md = BL_CAST(BL_MOB, bl);
+
+	if (md != NULL && type >= 0 && type < SC_MAX)
+		mob_ai_update_inhibit(md, type);
+	return retVal;
+}
+
+static int status_change_end_post(int retVal, struct block_list *bl, enum sc_type type, int tid, const char *file, int line)
+{
+	struct mob_data *md = BL_CAST(BL_MOB, bl);
+
+	if (md != NULL && type >= 0 && type < SC_MAX)
+		mob_ai_update_inhibit(md, type);
+	return retVal;
+}
+
+static bool mob_ai_sub_hard_think(struct mob_data *md, int64 tick)
 {
 	struct block_list *tbl = NULL, *abl = NULL;
-	uint32 mode;
+	struct mob_ai_data *ad;
+	uint32 mode, inhibit;
 	int view_range, can_move;
 
 	nullpo_retr(false, md);
 	if(md->bl.prev == NULL || md->status.hp <= 0)
-		return false;
+		AI_RETURN(AIPATH_SKIP, false);
 
 	if (DIFF_TICK(tick, md->last_thinktime) < MIN_MOBTHINKTIME)
-		return false;
+		AI_RETURN(AIPATH_SKIP, false);
+
+	if (ai_sched_defer(md, tick))
+		AI_RETURN(AIPATH_DEFERRED, false);
 
 	md->last_thinktime = tick;
 
 	if (md->ud.skilltimer != INVALID_TIMER)
-		return false;
+		AI_RETURN(AIPATH_SKIP, false);
+
+	ad = mob_ai_data(md, true);
+	inhibit = ad->inhibit;
+	// Fire damage burns the web by zeroing val1 without ending SC_SPIDERWEB
+	if ((inhibit&AI_INHIBIT_SPIDERWEB) && !(md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1))
+		inhibit &= ~AI_INHIBIT_SPIDERWEB;
 
 	// Abnormalities
 	if(( md->sc.opt1 > 0 && md->sc.opt1 != OPT1_STONEWAIT && md->sc.opt1 != OPT1_BURNING && md->sc.opt1 != OPT1_CRYSTALIZE )
-	  || md->sc.data[SC_DEEP_SLEEP] || md->sc.data[SC_BLADESTOP] || md->sc.data[SC__MANHOLE] || md->sc.data[SC_CURSEDCIRCLE_TARGET]) {
+	  || (inhibit&AI_INHIBIT_ABNORMAL)) {
 		//Should reset targets.
 		md->target_id = md->attacked_id = 0;
-		return false;
+		AI_RETURN(AIPATH_ABNORMAL, false);
 	}
 
-	if (md->sc.count && md->sc.data[SC_BLIND])
+	if (inhibit&AI_INHIBIT_BLIND)
 		view_range = 3;
 	else
 		view_range = md->db->range2;
@@ -114,7 +1030,7 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 	if (md->target_id) {
 		//Check validity of current target. [Skotlex]
 		struct map_session_data *tsd = NULL;
-		tbl = map->id2bl(md->target_id);
+		tbl = ai_handle_get(&ad->target, md->target_id);
 		tsd = BL_CAST(BL_PC, tbl);
 		if (tbl == NULL || tbl->m != md->bl.m
 		 || (md->ud.attacktimer == INVALID_TIMER && !status->check_skilluse(&md->bl, tbl, 0, 0))
@@ -123,10 +1039,10 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 		) {
 			//No valid target
 			if (mob->warpchase(md, tbl))
-				return true; //Chasing this target.
+				AI_RETURN(AIPATH_TARGET_INVALID, true); //Chasing this target.
 			if(md->ud.walktimer != INVALID_TIMER && (!can_move || md->ud.walkpath.path_pos <= battle->bc->mob_chase_refresh)
 				&& (tbl || md->ud.walkpath.path_pos == 0))
-				return true; //Walk at least "mob_chase_refresh" cells before dropping the target unless target is non-existent
+				AI_RETURN(AIPATH_TARGET_INVALID, true); //Walk at least "mob_chase_refresh" cells before dropping the target unless target is non-existent
 			mob->unlocktarget(md, tick); //Unlock target
 			tbl = NULL;
 		}
@@ -138,12 +1054,11 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 			//Rude attacked check.
 			if (!battle->check_range(&md->bl, tbl, md->status.rhw.range)
 			 && ( //Can't attack back and can't reach back.
-			       (!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle->bc->mob_ai&0x2 || (md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1)
-			      || md->sc.data[SC_WUGBITE] || md->sc.data[SC_VACUUM_EXTREME] || md->sc.data[SC_THORNS_TRAP]
-			      || md->sc.data[SC__MANHOLE] // Not yet confirmed if boss will teleport once it can't reach target.
+			       (!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle->bc->mob_ai&0x2
+			      || (inhibit&AI_INHIBIT_TRAPPED) // SC__MANHOLE: Not yet confirmed if boss will teleport once it can't reach target.
 			      || md->walktoxy_fail_count > 0)
 			       )
-			    || !mob->can_reach(md, tbl, md->min_chase, MSS_RUSH)
+			    || !mob_can_reach_cached(md, tbl, md->min_chase, MSS_RUSH, tick)
 			    )
 			 && md->state.attacked_count++ >= RUDE_ATTACKED_COUNT
 			 && mob->use_skill(md, tick, MSC_RUDEATTACKED) != 0 // If can't rude Attack
@@ -151,11 +1066,11 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 			) {
 				//Escaped
 				md->attacked_id = 0;
-				return true;
+				AI_RETURN(AIPATH_RUDE_ESCAPE, true);
 			}
 		}
 		else
-		if( (abl = map->id2bl(md->attacked_id)) && (!tbl || mob->can_changetarget(md, abl, mode) || (md->sc.count && md->sc.data[SC__CHAOS]))) {
+		if( (abl = ai_handle_get(&ad->attacker, md->attacked_id)) && (!tbl || mob->can_changetarget(md, abl, mode) || (inhibit&AI_INHIBIT_CHAOS))) {
 			int dist;
 			if( md->bl.m != abl->m || abl->prev == NULL
 			 || (dist = distance_bl(&md->bl, abl)) >= MAX_MINCHASE // Attacker longer than visual area
@@ -163,12 +1078,11 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 			 || (battle->bc->mob_ai&0x2 && !status->check_skilluse(&md->bl, abl, 0, 0)) // Cannot normal attack back to Attacker
 			 || (!battle->check_range(&md->bl, abl, md->status.rhw.range) // Not on Melee Range and ...
 			    && ( // Reach check
-					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle->bc->mob_ai&0x2 || (md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1)
-						|| md->sc.data[SC_WUGBITE] || md->sc.data[SC_VACUUM_EXTREME] || md->sc.data[SC_THORNS_TRAP]
-						|| md->sc.data[SC__MANHOLE] // Not yet confirmed if boss will teleport once it can't reach target.
+					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle->bc->mob_ai&0x2
+						|| (inhibit&AI_INHIBIT_TRAPPED) // SC__MANHOLE: Not yet confirmed if boss will teleport once it can't reach target.
 						|| md->walktoxy_fail_count > 0)
 					)
-					   || !mob->can_reach(md, abl, dist+md->db->range3, MSS_RUSH)
+					   || !mob_can_reach_cached(md, abl, dist+md->db->range3, MSS_RUSH, tick)
 			       )
 			    )
 			) {
@@ -180,7 +1094,7 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 					//Escaped.
 					//TODO: Maybe it shouldn't attempt to run if it has another, valid target?
 					md->attacked_id = 0;
-					return true;
+					AI_RETURN(AIPATH_RUDE_ESCAPE, true);
 				}
 			}
 			else
@@ -211,7 +1125,7 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 
 	// Processing of slave monster
 	if (md->master_id > 0 && mob->ai_sub_hard_slavemob(md, tick))
-		return true;
+		AI_RETURN(AIPATH_SLAVE, true);
 
 	// Scan area for targets
 	if (battle->bc->monster_loot_type != 1 && tbl == NULL && (mode & MD_LOOTER) != 0x0 && md->lootitem != NULL
@@ -221,8 +1135,19 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 	}
 
 	if ((!tbl && mode&MD_AGGRESSIVE) || md->state.skillstate == MSS_FOLLOW) {
-		map->foreachinrange(mob->ai_sub_hard_activesearch, &md->bl, view_range, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
-	} else if ((mode&MD_CHANGECHASE && (md->state.skillstate == MSS_RUSH || md->state.skillstate == MSS_FOLLOW)) || (md->sc.count && md->sc.data[SC__CHAOS])) {
+		int16 x0, y0, x1, y1;
+
+		if (md->special_state.ai != AI_NONE || md->bg_id != 0 || md->state.killer) {
+			// May target other mobs, which the occupancy grid doesn't count.
+			map->foreachinrange(mob->ai_sub_hard_activesearch, &md->bl, view_range, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
+		} else if (map_occupancy_area(md->bl.m, md->bl.x, md->bl.y, view_range, &x0, &y0, &x1, &y1) > 0) {
+#ifdef CIRCULAR_AREA
+			map->foreachinrange(mob->ai_sub_hard_activesearch, &md->bl, view_range, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
+#else
+			map->foreachinarea(mob->ai_sub_hard_activesearch, md->bl.m, x0, y0, x1, y1, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
+#endif
+		}
+	} else if ((mode&MD_CHANGECHASE && (md->state.skillstate == MSS_RUSH || md->state.skillstate == MSS_FOLLOW)) || (inhibit&AI_INHIBIT_CHAOS)) {
 		int search_size;
 		search_size = view_range<md->status.rhw.range ? view_range:md->status.rhw.range;
 		map->foreachinrange (mob->ai_sub_hard_changechase, &md->bl, search_size, DEFAULT_ENEMY_TYPE(md), md, &tbl);
@@ -235,17 +1160,17 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 		/* bg guardians follow allies when no targets nearby */
 		if( md->bg_id && mode&MD_CANATTACK ) {
 			if( md->ud.walktimer != INVALID_TIMER )
-				return true;/* we are already moving */
+				AI_RETURN(AIPATH_UNLOCK, true);/* we are already moving */
 			map->foreachinrange (mob->ai_sub_hard_bg_ally, &md->bl, view_range, BL_PC, md, &tbl, mode);
 			if( tbl ) {
 				if (distance_blxy(&md->bl, tbl->x, tbl->y) <= 3 || unit->walk_tobl(&md->bl, tbl, 1, 1) == 0)
-					return true;/* we're moving or close enough don't unlock the target. */
+					AI_RETURN(AIPATH_UNLOCK, true);/* we're moving or close enough don't unlock the target. */
 			}
 		}
 
 		//This handles triggering idle/walk skill.
 		mob->unlocktarget(md, tick);
-		return true;
+		AI_RETURN(AIPATH_UNLOCK, true);
 	}
 
 	//Target exists, attack or loot as applicable.
@@ -253,29 +1178,29 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 		//Loot time.
 		struct flooritem_data *fitem = BL_UCAST(BL_ITEM, tbl);
 		if (md->ud.target == tbl->id && md->ud.walktimer != INVALID_TIMER)
-			return true; //Already locked.
+			AI_RETURN(AIPATH_LOOT_WALK, true); //Already locked.
 		if (md->lootitem == NULL) {
 			//Can't loot...
 			mob->unlocktarget (md, tick);
-			return true;
+			AI_RETURN(AIPATH_UNLOCK, true);
 		}
 		if (!check_distance_bl(&md->bl, tbl, 1)) {
 			//Still not within loot range.
 			if (!(mode&MD_CANMOVE)) {
 				//A looter that can't move? Real smart.
 				mob->unlocktarget(md,tick);
-				return true;
+				AI_RETURN(AIPATH_UNLOCK, true);
 			}
 			if (!can_move) //Stuck. Wait before walking.
-				return true;
+				AI_RETURN(AIPATH_LOOT_WALK, true);
 			md->state.skillstate = MSS_LOOT;
-			if (unit->walk_tobl(&md->bl, tbl, 1, 1) != 0)
+			if (mob_walk_toloot(md, tbl) != 0)
 				mob->unlocktarget(md, tick); //Can't loot...
-			return true;
+			AI_RETURN(AIPATH_LOOT_WALK, true);
 		}
 		//Within looting range.
 		if (md->ud.attacktimer != INVALID_TIMER)
-			return true; //Busy attacking?
+			AI_RETURN(AIPATH_LOOT_PICKUP, true); //Busy attacking?
 
 		//Logs items, taken by (L)ooter Mobs [Lupus]
 		logs->pick_mob(md, LOG_TYPE_LOOT, fitem->item_data.amount, &fitem->item_data, NULL);
@@ -284,7 +1209,7 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 			memcpy (&md->lootitem[md->lootitem_count++], &fitem->item_data, sizeof(md->lootitem[0]));
 		} else {
 			//Inventory is full, do not pick up item.
-			return; // skip picking up item
+			AI_RETURN(AIPATH_LOOT_PICKUP, true); // skip picking up item
 		}
 		if (pc->db_checkid(md->vd->class)) {
 			//Give them walk act/delay to properly mimic players. [Skotlex]
@@ -295,7 +1220,7 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 		//Clear item.
 		map->clearflooritem (tbl);
 		mob->unlocktarget (md,tick);
-		return true;
+		AI_RETURN(AIPATH_LOOT_PICKUP, true);
 	}
 
 	//Attempt to attack.
@@ -308,7 +1233,7 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 				mob->log_damage(md, tbl, 0); //Log interaction (counts as 'attacker' for the exp bonus)
 			unit->attack(&md->bl,tbl->id,1);
 		}
-		return true;
+		AI_RETURN(AIPATH_ATTACK, true);
 	}
 
 	//Monsters in berserk state, unable to use normal attacks, will always attempt a skill
@@ -321,11 +1246,11 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 
 	//Target still in attack range, no need to chase the target
 	if(battle->check_range(&md->bl, tbl, md->status.rhw.range))
-		return true;
+		AI_RETURN(AIPATH_ATTACK, true);
 
 	//Only update target cell / drop target after having moved at least "mob_chase_refresh" cells
 	if(md->ud.walktimer != INVALID_TIMER && (!can_move || md->ud.walkpath.path_pos <= battle->bc->mob_chase_refresh))
-		return true;
+		AI_RETURN(AIPATH_CHASE, true);
 
 	//Out of range...
 	if (!(mode&MD_CANMOVE) || (!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0)) {
@@ -335,7 +1260,7 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 			//This handles triggering idle/walk skill.
 			mob->unlocktarget(md,tick);
 		}
-		return true;
+		AI_RETURN(AIPATH_UNLOCK, true);
 	}
 
 	if (md->ud.walktimer != INVALID_TIMER && md->ud.target == tbl->id &&
@@ -343,22 +1268,366 @@ static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
 			!(battle->bc->mob_ai&0x1) ||
 			check_distance_blxy(tbl, md->ud.to_x, md->ud.to_y, md->status.rhw.range)
 	)) //Current target tile is still within attack range.
-		return true;
+		AI_RETURN(AIPATH_CHASE, true);
 
 	//Follow up if possible.
 	//Hint: Chase skills are handled in the walktobl routine
-	if (mob->can_reach(md, tbl, md->min_chase, MSS_RUSH) == 0
+	if (mob_can_reach_cached(md, tbl, md->min_chase, MSS_RUSH, tick) == 0
 	    || unit->walk_tobl(&md->bl, tbl, md->status.rhw.range, 2) != 0)
 		mob->unlocktarget(md,tick);
 
-	return true;
+	AI_RETURN(AIPATH_CHASE, true);
+}
+
+static bool mob_ai_sub_hard_mine(struct mob_data *md, int64 tick)
+{
+#ifdef LOOTER_AI_PROFILE
+	uint64 start = aiprof_cycles();
+	bool ret;
+
+	aiprof_path = AIPATH_SKIP;
+	ret = mob_ai_sub_hard_think(md, tick);
+	aiprof_record(md, aiprof_path, aiprof_cycles() - start);
+	return ret;
+#else
+	return mob_ai_sub_hard_think(md, tick);
+#endif
+}
+
+static void loot_snapshot_key(const struct spawn_data *spawn, struct loot_snapshot_record *rec)
+{
+	memset(rec, 0, sizeof(*rec));
+	safestrncpy(rec->mapname, map->list[spawn->m].name, sizeof(rec->mapname));
+	rec->x = spawn->x;
+	rec->y = spawn->y;
+	rec->xs = spawn->xs;
+	rec->ys = spawn->ys;
+	rec->class_ = spawn->class_;
+}
+
+// FNV-1a over the spawn part of a record.
+static uint32 loot_snapshot_hash(const struct loot_snapshot_record *rec)
+{
+	const unsigned char *p = (const unsigned char *)rec;
+	uint32 hash = 2166136261U;
+	size_t i;
+
+	for (i = 0; i < offsetof(struct loot_snapshot_record, count); i++)
+		hash = (hash ^ p[i]) * 16777619U;
+	return hash;
+}
+
+static int loot_snapshot_entry_cmp(const void *a, const void *b)
+{
+	const struct loot_snapshot_entry *ea = a, *eb = b;
+
+	if (ea->hash != eb->hash)
+		return ea->hash < eb->hash ? -1 : 1;
+	return ea->offset < eb->offset ? -1 : (ea->offset > eb->offset);
+}
+
+static void loot_snapshot_release(void)
+{
+	if (loot_snapshot != NULL) {
+#ifdef WIN32
+		aFree((void *)loot_snapshot);
+#else
+		munmap((void *)loot_snapshot, loot_snapshot_size);
+#endif
+	}
+	loot_snapshot = NULL;
+	loot_snapshot_size = 0;
+	aFree(loot_snapshot_index);
+	loot_snapshot_index = NULL;
+	loot_snapshot_count = loot_snapshot_claimed = 0;
+}
+
+// Maps the snapshot and indexes its records. The items themselves are only
+// read when a mob of their spawn comes back.
+static void loot_snapshot_load(void)
+{
+	struct loot_snapshot_header header;
+	size_t offset;
+	uint32 i;
+
+#ifdef WIN32
+	FILE *fp = fopen(loot_snapshot_file, "rb");
+	unsigned char *buf;
+	long size;
+
+	if (fp == NULL)
+		return;
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (size <= 0) {
+		fclose(fp);
+		return;
+	}
+	buf = aMalloc(size);
+	if (fread(buf, 1, size, fp) != (size_t)size) {
+		ShowError("%s: failed to read '%s'.\n", pinfo.name, loot_snapshot_file);
+		fclose(fp);
+		aFree(buf);
+		return;
+	}
+	fclose(fp);
+	loot_snapshot = buf;
+	loot_snapshot_size = size;
+#else
+	struct stat st;
+	void *buf;
+	int fd = open(loot_snapshot_file, O_RDONLY);
+
+	if (fd < 0)
+		return;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return;
+	}
+	buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (buf == MAP_FAILED) {
+		ShowError("%s: failed to map '%s'.\n", pinfo.name, loot_snapshot_file);
+		return;
+	}
+	madvise(buf, st.st_size, MADV_SEQUENTIAL);
+	loot_snapshot = buf;
+	loot_snapshot_size = st.st_size;
+#endif
+
+	// The records are handed out from memory from now on.
+	remove(loot_snapshot_file);
+
+	if (loot_snapshot_size < sizeof(header)) {
+		ShowError("%s: '%s' is truncated, looter inventories were not restored.\n", pinfo.name, loot_snapshot_file);
+		loot_snapshot_release();
+		return;
+	}
+	memcpy(&header, loot_snapshot, sizeof(header));
+	if (memcmp(header.magic, LOOT_SNAPSHOT_MAGIC, sizeof(header.magic)) != 0
+	 || header.version != LOOT_SNAPSHOT_VERSION || header.item_size != sizeof(struct item)) {
+		ShowError("%s: '%s' was written by an incompatible server, looter inventories were not restored.\n", pinfo.name, loot_snapshot_file);
+		loot_snapshot_release();
+		return;
+	}
+
+	CREATE(loot_snapshot_index, struct loot_snapshot_entry, max(header.records, 1));
+	offset = sizeof(header);
+	for (i = 0; i < header.records; i++) {
+		struct loot_snapshot_record rec;
+
+		if (loot_snapshot_size - offset < sizeof(rec))
+			break;
+		memcpy(&rec, loot_snapshot + offset, sizeof(rec));
+		if (rec.count == 0 || rec.count > LOOTITEM_SIZE
+		 || (loot_snapshot_size - offset - sizeof(rec)) / sizeof(struct item) < rec.count)
+			break;
+
+		loot_snapshot_index[loot_snapshot_count].hash = loot_snapshot_hash(&rec);
+		loot_snapshot_index[loot_snapshot_count].claimed = false;
+		loot_snapshot_index[loot_snapshot_count].offset = offset;
+		loot_snapshot_count++;
+		offset += sizeof(rec) + rec.count * sizeof(struct item);
+	}
+	if (i < header.records)
+		ShowWarning("%s: '%s' is damaged, only %u of %u looter inventories can be restored.\n", pinfo.name, loot_snapshot_file, i, header.records);
+
+	if (loot_snapshot_count == 0) {
+		loot_snapshot_release();
+		return;
+	}
+	qsort(loot_snapshot_index, loot_snapshot_count, sizeof(*loot_snapshot_index), loot_snapshot_entry_cmp);
+	ShowStatus("%s: '"CL_WHITE"%d"CL_RESET"' looter inventories are waiting for their spawn.\n", pinfo.name, loot_snapshot_count);
+}
+
+// Gives a freshly spawned looter the inventory one of the mobs of its spawn had at shutdown.
+static int mob_spawn_post(int retVal, struct mob_data *md)
+{
+	struct loot_snapshot_record key;
+	uint32 hash;
+	int lo, hi;
+
+	if (retVal != 0 || loot_snapshot == NULL || md->spawn == NULL || md->lootitem == NULL)
+		return retVal;
+
+	loot_snapshot_key(md->spawn, &key);
+	hash = loot_snapshot_hash(&key);
+
+	lo = 0;
+	hi = loot_snapshot_count;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		if (loot_snapshot_index[mid].hash < hash)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	for (; lo < loot_snapshot_count && loot_snapshot_index[lo].hash == hash; lo++) {
+		struct loot_snapshot_entry *entry = &loot_snapshot_index[lo];
+		struct loot_snapshot_record rec;
+
+		if (entry->claimed)
+			continue;
+		memcpy(&rec, loot_snapshot + entry->offset, sizeof(rec));
+		if (memcmp(&rec, &key, offsetof(struct loot_snapshot_record, count)) != 0)
+			continue;
+
+		memcpy(md->lootitem, loot_snapshot + entry->offset + sizeof(rec), rec.count * sizeof(struct item));
+		md->lootitem_count = rec.count;
+		entry->claimed = true;
+		if (++loot_snapshot_claimed == loot_snapshot_count)
+			loot_snapshot_release();
+		break;
+	}
+	return retVal;
+}
+
+static int loot_snapshot_save_sub(struct mob_data *md, va_list ap)
+{
+	FILE *fp = va_arg(ap, FILE *);
+	struct loot_snapshot_record rec;
+
+	if (md->spawn == NULL || md->lootitem == NULL || md->lootitem_count == 0 || md->bl.prev == NULL)
+		return 0;
+
+	loot_snapshot_key(md->spawn, &rec);
+	rec.count = (uint16)min(md->lootitem_count, LOOTITEM_SIZE);
+	fwrite(&rec, sizeof(rec), 1, fp);
+	fwrite(md->lootitem, sizeof(struct item), rec.count, fp);
+	return 1;
+}
+
+// Streams the inventory of every looter on the map to a temporary file that
+// replaces the snapshot once complete. Records that were never given back since
+// startup (their spawn didn't come back yet) are carried over.
+static void loot_snapshot_save(void)
+{
+	struct loot_snapshot_header header;
+	char tmpfile[256];
+	int64 start = timer->gettick();
+	int i;
+	FILE *fp;
+
+	snprintf(tmpfile, sizeof(tmpfile), "%s.tmp", loot_snapshot_file);
+	if ((fp = fopen(tmpfile, "wb")) == NULL) {
+		ShowError("%s: can't write '%s', looter inventories are lost.\n", pinfo.name, tmpfile);
+		return;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, LOOT_SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = LOOT_SNAPSHOT_VERSION;
+	header.item_size = sizeof(struct item);
+	fwrite(&header, sizeof(header), 1, fp);
+
+	header.records = map->foreachmob(loot_snapshot_save_sub, fp);
+	for (i = 0; i < loot_snapshot_count; i++) {
+		const struct loot_snapshot_entry *entry = &loot_snapshot_index[i];
+		struct loot_snapshot_record rec;
+
+		if (entry->claimed)
+			continue;
+		memcpy(&rec, loot_snapshot + entry->offset, sizeof(rec));
+		fwrite(loot_snapshot + entry->offset, sizeof(rec) + rec.count * sizeof(struct item), 1, fp);
+		header.records++;
+	}
+	loot_snapshot_release();
+
+	fseek(fp, 0, SEEK_SET);
+	fwrite(&header, sizeof(header), 1, fp);
+	if (ferror(fp) != 0) {
+		ShowError("%s: failed writing '%s', looter inventories are lost.\n", pinfo.name, tmpfile);
+		fclose(fp);
+		remove(tmpfile);
+		return;
+	}
+	fclose(fp);
+
+	if (header.records == 0) {
+		remove(tmpfile);
+		return;
+	}
+	remove(loot_snapshot_file);
+	if (rename(tmpfile, loot_snapshot_file) != 0) {
+		ShowError("%s: can't rename '%s' to '%s', looter inventories are lost.\n", pinfo.name, tmpfile, loot_snapshot_file);
+		return;
+	}
+	ShowStatus("%s: saved '"CL_WHITE"%u"CL_RESET"' looter inventories in %"PRId64" ms.\n", pinfo.name, header.records, timer->gettick() - start);
+}
+
+static struct pluginperf_histogram perf_mob_ai_sub_hard;
+
+static bool mob_ai_sub_hard_probe(struct mob_data *md, int64 tick)
+{
+	bool ret;
+
+	PLUGINPERF_TIME(perf_mob_ai_sub_hard, ret = mob_ai_sub_hard_mine(md, tick));
+	return ret;
 }
 
 HPExport void plugin_init(void) {
-	mob->ai_sub_hard = mob_ai_sub_hard_mine;
+	mob->ai_sub_hard = mob_ai_sub_hard_probe;
+
+	pluginperf_init(pinfo.name);
+	pluginperf_register(&perf_mob_ai_sub_hard, "mob->ai_sub_hard");
+
+	addHookPost(status, change_start, status_change_start_post);
+	addHookPost(status, change_end_, status_change_end_post);
+	addHookPost(map, setcell, map_setcell_post);
+	addHookPost(map, setgatcell, map_setgatcell_post);
+	addHookPre(map, addblock, map_addblock_pre);
+	addHookPost(map, addblock, map_addblock_post);
+	addHookPre(map, delblock, map_delblock_pre);
+	addHookPre(mob, ai_hard, mob_ai_hard_pre);
+	addHookPost(mob, ai_hard, mob_ai_hard_post);
+	addHookPre(map, deliddb, map_deliddb_pre);
+	addHookPre(path, search, path_search_pre);
+	addHookPost(path, search, path_search_post);
+	addHookPost(mob, spawn, mob_spawn_post);
+
+	addAtcommand("aisched", aisched);
+
+	loot_snapshot_load();
+
+	timer->add_func_list(mob_reach_cache_report, "mob_reach_cache_report");
+
+#ifdef LOOTER_AI_PROFILE
+	aiprof_db = idb_alloc(DB_OPT_RELEASE_DATA);
+	timer->add_func_list(aiprof_rotate, "aiprof_rotate");
+	addAtcommand("aiprof", aiprof);
+#endif
+}
+
+HPExport void plugin_final(void)
+{
+	int i;
+
+	pluginperf_dump();
+	loot_snapshot_save();
+
+	for (i = 0; i < map_occupancy_size; i++)
+		aFree(map_occupancy[i].count);
+	aFree(map_occupancy);
+	map_occupancy = NULL;
+	map_occupancy_size = 0;
+
+	aFree(ai_sched_queue);
+	ai_sched_queue = NULL;
+	ai_sched_len = ai_sched_max = 0;
+
+#ifdef LOOTER_AI_PROFILE
+	db_destroy(aiprof_db);
+#endif
 }
 
 HPExport void server_online(void)
 {
 	ShowInfo("'%s' Plugin by Ghost/Seabois. Version '%s'\n", pinfo.name, pinfo.version);
+
+	timer->add_interval(timer->gettick() + REACH_CACHE_REPORT_INTERVAL, mob_reach_cache_report, 0, 0, REACH_CACHE_REPORT_INTERVAL);
+#ifdef LOOTER_AI_PROFILE
+	timer->add_interval(timer->gettick() + 1000, aiprof_rotate, 0, 0, 1000);
+#endif
 }
\ No newline at end of file
@@ -3,12 +3,18 @@
 //===== By: ==================================================
 //= Ghost / Seabois
 //===== Current Version: =====================================
-//= 1.0
+//= 1.6
 //===== Description: =========================================
 //= Adds MobID besides Mobname
 //= query using mob name.
 //===== Changelog: ===========================================
 //= v1.0 - Initial Conversion
+//= v1.1 - Display names are built once per mob class
+//= v1.2 - Requester-only reply mode and @mobnamestats counters
+//= v1.3 - Name requests are queued per connection, deduplicated and rate limited
+//= v1.4 - Optional level and HP percentage display, refreshed when the HP step changes
+//= v1.5 - Name packets are cached per mob until something shown in them changes
+//= v1.6 - Hook latency histograms (@pluginperf)
 //===== Additional Comments: =================================
 //= 
 //===== Repo Link: ===========================================
@@ -21,6 +27,9 @@
 #include "map/clif.h"
 #include "map/mob.h"
 #include "map/battle.h"
+#include "map/atcommand.h"
+#include "map/map.h"
+#include "map/pc.h"
 
 
 #include "common/HPMi.h"
@@ -46,49 +55,470 @@
 #include <time.h>
 
 #include "plugins/HPMHooking.h"
+#include "pluginperf.h"
 #include "common/HPMDataCheck.h"
 
+#define MOBID_QUEUE_SIZE 32 // Mobs one connection can have waiting for their name
+#define MOBID_RECENT_SIZE 32 // Answered requests remembered per connection to drop repeats
+#define MOBID_MAX_LEVEL 999 // Highest level with a precomputed level text, higher levels show as this
+
 HPExport struct hplugin_info pinfo = {
 	"MobIDDisplay",		// Plugin name
 	SERVER_TYPE_MAP,// Which server types this plugin works with?
-	"1.0",			// Plugin version
+	"1.6",			// Plugin version
 	HPM_VERSION,	// HPM Version (don't change, macro is automatically updated)
 };
 
+// Where name packets go. Replies to a client's name request always go to that client only.
+// 0: Name refreshes (a mob was renamed) are sent to every player in the area, as official.
+// 1: Requester only, name refreshes are not sent. Clients get the new name on their next request.
+int mobid_reply_mode = 0;
+
+// Name requests of a connection are answered once per server tick. Repeated requests for the same
+// mob within mobid_dedupe_window ms are dropped, and at most mobid_name_rate are answered per second.
+int mobid_dedupe_window = 1000;
+int mobid_name_rate = 100; // 0 for no limit
+
+// 1: Show the mob level and HP percentage after the ID. The name is refreshed
+// for players around the mob when its HP crosses a mobid_hp_step percent step.
+int mobid_show_status = 0;
+int mobid_hp_step = 10;
+
+enum mobid_send {
+	MOBID_SEND_SELF,    // Reply to the requesting client
+	MOBID_SEND_AREA,    // Area refresh, counted per receiving player
+	MOBID_SEND_SKIPPED, // Area refresh not sent in requester-only mode, counted per player it would have reached
+	MOBID_SEND_DEDUPED, // Request for a name that is queued or was just answered
+	MOBID_SEND_THROTTLED, // Request over mobid_name_rate or with a full queue
+	MOBID_SEND_MAX
+};
+
+static unsigned int mobid_sent_second[MOBID_SEND_MAX]; // Current second
+static unsigned int mobid_sent_last[MOBID_SEND_MAX];   // Previous second
+static unsigned int mobid_sent_peak[MOBID_SEND_MAX];   // Busiest second
+static uint64 mobid_sent_total[MOBID_SEND_MAX];
+
+// Name requests of one connection, attached through HPM session data.
+struct mobid_session {
+	int queue[MOBID_QUEUE_SIZE]; // Ids of the mobs waiting for a reply
+	int queued;
+	struct {
+		int id;
+		int64 tick;
+	} recent[MOBID_RECENT_SIZE]; // Last answered requests
+	int recent_next;
+	int64 second_tick; // Start of the current rate limit second
+	int second_count;  // Requests accepted in it
+	unsigned int throttled; // Requests dropped over the rate limit since login
+	bool pending; // In mobid_flush_fds
+};
+
+static int *mobid_flush_fds = NULL; // Connections with queued requests
+static int mobid_flush_count = 0;
+static int mobid_flush_max = 0;
+static int mobid_flush_tid = INVALID_TIMER;
+
+// Display name of a mob class, or of a mob that was given its own name.
+struct mobid_name {
+	char name[NAME_LENGTH];    // Mob name the display name was built from
+	char display[NAME_LENGTH]; // "name [class]"
+};
+
+// Name packet last built for a mob and what it was built from.
+struct mobid_packet {
+	bool valid;
+	unsigned int names_generation; // mobid_names_generation
+	int class_;
+	int level;
+	int hp_percent; // -1 when built without status
+	char name[NAME_LENGTH]; // md->name
+	struct PACKET_ZC_ACK_REQNAME_TITLE packet;
+};
+
+// Per-mob data, attached through HPM mob data.
+struct mobid_data {
+	struct mobid_name custom; // Display name of a mob not named like its class
+	int hp_step; // HP percent step last shown, -1 if none
+	struct mobid_packet cache;
+};
+
+static struct mobid_name *mobid_names = NULL; // MAX_MOB_DB entries, built from the mob database
+static unsigned int mobid_names_generation = 0; // Bumped whenever mobid_names is rebuilt
+
+static char mobid_level_text[MOBID_MAX_LEVEL + 1][8]; // " Lv123"
+static char mobid_hp_text[101][6]; // " 100%"
+
 static inline int get_percentage(unsigned int val, unsigned int max) {
-	return (max > 0) ? ((val * 100) / max) : 0;
+	return (max > 0) ? (int)((uint64)val * 100 / max) : 0;
+}
+
+static void mobid_status_texts_build(void)
+{
+	int i;
+
+	for (i = 0; i <= MOBID_MAX_LEVEL; i++)
+		snprintf(mobid_level_text[i], sizeof(mobid_level_text[i]), " Lv%d", i);
+	for (i = 0; i <= 100; i++)
+		snprintf(mobid_hp_text[i], sizeof(mobid_hp_text[i]), " %d%%", i);
+}
+
+static struct mobid_data *mobid_data(struct mob_data *md)
+{
+	struct mobid_data *data;
+
+	if ((data = getFromMOBDATA(md, 0)) == NULL) {
+		CREATE(data, struct mobid_data, 1);
+		data->hp_step = -1;
+		addToMOBDATA(md, data, 0, true);
+	}
+	return data;
+}
+
+// HP percentage of a mob, rounded down to its mobid_hp_step.
+// Capped at 100: HP stays above max HP for a moment when a status lowers it.
+static int mobid_hp_percent(const struct mob_data *md)
+{
+	int step = cap_value(mobid_hp_step, 1, 100);
+	int percent = cap_value(get_percentage(md->status.hp, md->status.max_hp), 0, 100);
+
+	return percent / step * step;
+}
+
+static void mobid_name_build(struct mobid_name *entry, const char *name, int class_)
+{
+	safestrncpy(entry->name, name, sizeof(entry->name));
+	memset(entry->display, 0, sizeof(entry->display));
+	snprintf(entry->display, sizeof(entry->display), "%s [%d]", name, class_);
+}
+
+static void mobid_names_build(void)
+{
+	int i;
+
+	if (mobid_names == NULL)
+		CREATE(mobid_names, struct mobid_name, MAX_MOB_DB);
+	mobid_names_generation++;
+
+	for (i = 0; i < MAX_MOB_DB; i++) {
+		if (mob->db_data[i] == NULL) {
+			memset(&mobid_names[i], 0, sizeof(mobid_names[i]));
+			continue;
+		}
+		mobid_name_build(&mobid_names[i], mob->db_data[i]->jname, i);
+	}
+}
+
+static void mob_reload_post(void)
+{
+	mobid_names_build();
+}
+
+// Display name of a mob. Renamed mobs keep their own copy in mob data,
+// rebuilt only when their name changes again.
+static const char *mobid_display_name(struct mob_data *md)
+{
+	struct mobid_name *entry;
+
+	if (mobid_names != NULL && md->class_ >= 0 && md->class_ < MAX_MOB_DB) {
+		entry = &mobid_names[md->class_];
+		if (entry->display[0] != '\0' && strncmp(md->name, entry->name, NAME_LENGTH) == 0)
+			return entry->display;
+	}
+
+	entry = &mobid_data(md)->custom;
+	if (entry->display[0] == '\0' || strncmp(md->name, entry->name, NAME_LENGTH) != 0)
+		mobid_name_build(entry, md->name, md->class_);
+	return entry->display;
+}
+
+static void mobid_name_append(char *name, size_t *len, const char *text)
+{
+	size_t n = strlen(text);
+
+	if (n > NAME_LENGTH - 1 - *len)
+		n = NAME_LENGTH - 1 - *len;
+	memcpy(name + *len, text, n);
+	*len += n;
+}
+
+// Fills the NAME_LENGTH name of a name packet.
+static void mobid_packet_name(char *name, struct mob_data *md)
+{
+	const char *display = mobid_display_name(md);
+	size_t len;
+	int percent;
+
+	if (mobid_show_status == 0) {
+		memcpy(name, display, NAME_LENGTH);
+		return;
+	}
+
+	percent = mobid_hp_percent(md);
+	mobid_data(md)->hp_step = percent;
+
+	len = strlen(display);
+	memcpy(name, display, len);
+	mobid_name_append(name, &len, mobid_level_text[cap_value(md->level, 0, MOBID_MAX_LEVEL)]);
+	mobid_name_append(name, &len, mobid_hp_text[percent]);
+	memset(name + len, 0, NAME_LENGTH - len);
+}
+
+static int mobid_count_pc_sub(struct block_list *bl, va_list ap)
+{
+	return 1;
+}
+
+static void mobid_count(enum mobid_send type, unsigned int packets)
+{
+	mobid_sent_second[type] += packets;
+	mobid_sent_total[type] += packets;
+}
+
+static int mobid_stats_rotate(int tid, int64 tick, int id, intptr_t data)
+{
+	int i;
+
+	for (i = 0; i < MOBID_SEND_MAX; i++) {
+		mobid_sent_last[i] = mobid_sent_second[i];
+		mobid_sent_peak[i] = max(mobid_sent_peak[i], mobid_sent_second[i]);
+		mobid_sent_second[i] = 0;
+	}
+	return 0;
+}
+
+ACMD(mobnamestats)
+{
+	static const char *labels[MOBID_SEND_MAX] = { "Replies", "Area refreshes", "Skipped refreshes", "Repeated requests", "Throttled requests" };
+	char output[CHAT_SIZE_MAX];
+	int i;
+
+	if (*message != '\0' && strcmpi(message, "reset") == 0) {
+		memset(mobid_sent_peak, 0, sizeof(mobid_sent_peak));
+		memset(mobid_sent_total, 0, sizeof(mobid_sent_total));
+		clif->message(fd, "Mob name packet counters have been reset.");
+		return true;
+	}
+
+	snprintf(output, sizeof(output), "Reply mode: %s, %d bytes per name packet.",
+		mobid_reply_mode == 1 ? "requester only" : "official", (int)sizeof(struct PACKET_ZC_ACK_REQNAME_TITLE));
+	clif->message(fd, output);
+	for (i = 0; i < MOBID_SEND_MAX; i++) {
+		snprintf(output, sizeof(output), "%s: %u last second, %u peak per second, %"PRIu64" total (%"PRIu64" bytes).",
+			labels[i], mobid_sent_last[i], mobid_sent_peak[i], mobid_sent_total[i],
+			mobid_sent_total[i] * sizeof(struct PACKET_ZC_ACK_REQNAME_TITLE));
+		clif->message(fd, output);
+	}
+	return true;
+}
+
+// Name packet of a mob. It is only rebuilt when the name, level, shown HP step,
+// title or group changed, scripts can change the last two at any time.
+static const struct PACKET_ZC_ACK_REQNAME_TITLE *mobid_name_packet(struct mob_data *md)
+{
+	struct mobid_packet *cache = &mobid_data(md)->cache;
+	int percent = mobid_show_status != 0 ? mobid_hp_percent(md) : -1;
+
+	if (cache->valid && cache->names_generation == mobid_names_generation && cache->class_ == md->class_ && cache->level == md->level && cache->hp_percent == percent
+	 && strncmp(cache->name, md->name, NAME_LENGTH) == 0
+#if PACKETVER_MAIN_NUM >= 20180207 || PACKETVER_RE_NUM >= 20171129 || PACKETVER_ZERO_NUM >= 20171130
+	 && cache->packet.groupId == md->ud.groupId
+	 && memcmp(cache->packet.title, md->ud.title, NAME_LENGTH) == 0
+#endif
+	   )
+		return &cache->packet;
+
+	memset(&cache->packet, 0, sizeof(cache->packet));
+	cache->packet.packet_id = HEADER_ZC_ACK_REQNAME_TITLE;
+	cache->packet.gid = md->bl.id;
+	mobid_packet_name(cache->packet.name, md);
+#if PACKETVER_MAIN_NUM >= 20180207 || PACKETVER_RE_NUM >= 20171129 || PACKETVER_ZERO_NUM >= 20171130
+	memcpy(cache->packet.title, md->ud.title, NAME_LENGTH);
+	cache->packet.groupId = md->ud.groupId;
+#endif
+	cache->valid = true;
+	cache->names_generation = mobid_names_generation;
+	cache->class_ = md->class_;
+	cache->level = md->level;
+	cache->hp_percent = percent;
+	memcpy(cache->name, md->name, NAME_LENGTH);
+	return &cache->packet;
+}
+
+static void mobid_send_name(int fd, struct block_list *bl)
+{
+	const struct PACKET_ZC_ACK_REQNAME_TITLE *packet = mobid_name_packet(BL_UCAST(BL_MOB, bl));
+
+	if (fd != 0) {
+		mobid_count(MOBID_SEND_SELF, 1);
+	} else {
+		unsigned int viewers = map->foreachinrange(mobid_count_pc_sub, bl, AREA_SIZE, BL_PC);
+
+		if (mobid_reply_mode == 1) {
+			mobid_count(MOBID_SEND_SKIPPED, viewers);
+			return;
+		}
+		mobid_count(MOBID_SEND_AREA, viewers);
+	}
+
+	clif->send_selforarea(fd, bl, packet, sizeof(struct PACKET_ZC_ACK_REQNAME_TITLE));
+}
+
+// Answers the queued name requests of every connection.
+static int mobid_flush(int tid, int64 tick, int id, intptr_t data)
+{
+	int i, j;
+
+	mobid_flush_tid = INVALID_TIMER;
+
+	for (i = 0; i < mobid_flush_count; i++) {
+		int fd = mobid_flush_fds[i];
+		struct map_session_data *sd;
+		struct mobid_session *ms;
+
+		if (!sockt->session_is_active(fd) || (ms = getFromSession(sockt->session[fd], 0)) == NULL)
+			continue;
+		ms->pending = false;
+		if ((sd = sockt->session[fd]->session_data) == NULL) {
+			ms->queued = 0;
+			continue;
+		}
+
+		for (j = 0; j < ms->queued; j++) {
+			struct block_list *bl = map->id2bl(ms->queue[j]);
+
+			if (bl == NULL || bl->type != BL_MOB || bl->m != sd->bl.m)
+				continue;
+			mobid_send_name(fd, bl);
+			ms->recent[ms->recent_next].id = bl->id;
+			ms->recent[ms->recent_next].tick = tick;
+			ms->recent_next = (ms->recent_next + 1) % MOBID_RECENT_SIZE;
+		}
+		ms->queued = 0;
+	}
+	mobid_flush_count = 0;
+	return 0;
+}
+
+// Refreshes the name for the players around a mob once its HP crossed a step.
+static void mobid_hp_changed(struct mob_data *md)
+{
+	struct mobid_data *data;
+
+	if (mobid_show_status == 0 || md->bl.prev == NULL)
+		return;
+	if ((data = getFromMOBDATA(md, 0)) == NULL || data->hp_step < 0)
+		return; // Nobody was sent the name yet
+	if (mobid_hp_percent(md) != data->hp_step)
+		mobid_send_name(0, &md->bl);
+}
+
+static void mob_damage_post(struct mob_data *md, struct block_list *src, int damage)
+{
+	mobid_hp_changed(md);
+}
+
+static void mob_heal_post(struct mob_data *md, unsigned int heal)
+{
+	mobid_hp_changed(md);
 }
 
 static void clif_mobname_additional_ack_with_mobid(int fd, struct block_list *bl)
 {
+	struct mobid_session *ms;
+	int64 tick;
+	int i;
+
 	nullpo_retv(bl);
 	Assert_retv(bl->type == BL_MOB);
 
-	struct PACKET_ZC_ACK_REQNAME_TITLE packet = { 0 };
-	packet.packet_id = HEADER_ZC_ACK_REQNAME_TITLE;
-	packet.gid = bl->id;
-	const struct mob_data *md = BL_UCCAST(BL_MOB, bl);
-	
-	char mobidline[NAME_LENGTH];
-	snprintf(mobidline, sizeof(mobidline), "%s [%d]",md->name, md->class_);
-	memcpy(packet.name, mobidline, NAME_LENGTH);
-#if PACKETVER_MAIN_NUM >= 20180207 || PACKETVER_RE_NUM >= 20171129 || PACKETVER_ZERO_NUM >= 20171130
-	struct unit_data *ud = unit->bl2ud(bl);
-	if (ud != NULL) {
-		memcpy(packet.title, ud->title, NAME_LENGTH);
-		packet.groupId = ud->groupId;
+	if (fd == 0 || !sockt->session_is_active(fd)) {
+		// Name refresh for the area, not a request.
+		mobid_send_name(fd, bl);
+		return;
 	}
-#endif
 
-	clif->send_selforarea(fd, bl, &packet, sizeof(struct PACKET_ZC_ACK_REQNAME_TITLE));
+	if ((ms = getFromSession(sockt->session[fd], 0)) == NULL) {
+		CREATE(ms, struct mobid_session, 1);
+		addToSession(sockt->session[fd], ms, 0, true);
+	}
+	tick = timer->gettick();
+
+	ARR_FIND(0, ms->queued, i, ms->queue[i] == bl->id);
+	if (i < ms->queued) {
+		mobid_count(MOBID_SEND_DEDUPED, 1);
+		return;
+	}
+	ARR_FIND(0, MOBID_RECENT_SIZE, i, ms->recent[i].id == bl->id && DIFF_TICK(tick, ms->recent[i].tick) < mobid_dedupe_window);
+	if (i < MOBID_RECENT_SIZE) {
+		mobid_count(MOBID_SEND_DEDUPED, 1);
+		return;
+	}
+
+	if (DIFF_TICK(tick, ms->second_tick) >= 1000) {
+		ms->second_tick = tick;
+		ms->second_count = 0;
+	}
+	if ((mobid_name_rate > 0 && ms->second_count >= mobid_name_rate) || ms->queued >= MOBID_QUEUE_SIZE) {
+		ms->throttled++;
+		mobid_count(MOBID_SEND_THROTTLED, 1);
+		return;
+	}
+	ms->second_count++;
+	ms->queue[ms->queued++] = bl->id;
+
+	if (!ms->pending) {
+		ms->pending = true;
+		if (mobid_flush_count == mobid_flush_max) {
+			mobid_flush_max += 32;
+			RECREATE(mobid_flush_fds, int, mobid_flush_max);
+		}
+		mobid_flush_fds[mobid_flush_count++] = fd;
+	}
+	if (mobid_flush_tid == INVALID_TIMER)
+		mobid_flush_tid = timer->add(tick, mobid_flush, 0, 0);
 }
 
 
+static struct pluginperf_histogram perf_mobname_ack;
+
+static void clif_mobname_ack_probe(int fd, struct block_list *bl)
+{
+	PLUGINPERF_TIME(perf_mobname_ack, clif_mobname_additional_ack_with_mobid(fd, bl));
+}
+
 HPExport void plugin_init(void) {
-	clif->mobname_normal_ack = clif_mobname_additional_ack_with_mobid;
+	clif->mobname_normal_ack = clif_mobname_ack_probe;
+
+	pluginperf_init(pinfo.name);
+	pluginperf_register(&perf_mobname_ack, "clif->mobname_normal_ack");
+
+	addHookPost(mob, reload, mob_reload_post);
+	addHookPost(mob, damage, mob_damage_post);
+	addHookPost(mob, heal, mob_heal_post);
+
+	addAtcommand("mobnamestats", mobnamestats);
+
+	mobid_status_texts_build();
+
+	timer->add_func_list(mobid_stats_rotate, "mobid_stats_rotate");
+	timer->add_func_list(mobid_flush, "mobid_flush");
+}
+
+HPExport void plugin_final(void)
+{
+	pluginperf_dump();
+	aFree(mobid_names);
+	mobid_names = NULL;
+	aFree(mobid_flush_fds);
+	mobid_flush_fds = NULL;
+	mobid_flush_count = mobid_flush_max = 0;
 }
 
 HPExport void server_online(void)
 {
 	ShowInfo("'%s' Plugin by Ghost/Seabois. Version '%s'\n", pinfo.name, pinfo.version);
+
+	mobid_names_build();
+
+	timer->add_interval(timer->gettick() + 1000, mobid_stats_rotate, 0, 0, 1000);
 }
\ No newline at end of file
@@ -0,0 +1,257 @@
+//===== Hercules Plugin ======================================
+//= pluginperf.h
+//===== By: ==================================================
+//= Ghost / Seabois
+//===== Current Version: =====================================
+//= 1.0
+//===== Description: =========================================
+//= Hook latency histograms shared by the plugins of this repo.
+//= Each plugin times its overridden functions into its own
+//= histograms; @pluginperf shows those of every loaded plugin.
+//===== Changelog: ===========================================
+//= v1.0 - Initial release
+//===== Additional Comments: =================================
+//= Include after map/pc.h and plugins/HPMHooking.h.
+//= Call pluginperf_init(pinfo.name) and pluginperf_register()
+//= in plugin_init, pluginperf_dump() in plugin_final, and
+//= time each overridden function with PLUGINPERF_TIME.
+//===== Repo Link: ===========================================
+//=
+//============================================================
+#ifndef PLUGINPERF_H
+#define PLUGINPERF_H
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef WIN32
+#include "common/winapi.h"
+#endif
+
+// 1: Time the hooks from startup. "@pluginperf on|off" switches every plugin at once.
+static int pluginperf_enabled = 0;
+
+#define PLUGINPERF_FILE "log/pluginperf.txt" // Histograms are appended here at shutdown
+#define PLUGINPERF_MAX_HOOKS 8 // Histograms per plugin
+
+// Log-linear buckets as in HdrHistogram: 16 per power of two, so a bucket is at most
+// 1/16 (6.25%) wide and any latency from 1ns up fits in PLUGINPERF_BUCKETS counters.
+#define PLUGINPERF_SUB_BITS 4
+#define PLUGINPERF_SUB_COUNT (1 << PLUGINPERF_SUB_BITS)
+#define PLUGINPERF_BUCKETS ((64 - PLUGINPERF_SUB_BITS + 1) * PLUGINPERF_SUB_COUNT)
+
+// Latencies of one hook, in nanoseconds
+struct pluginperf_histogram {
+	const char *name;
+	uint64 count;
+	uint64 sum;
+	uint64 min, max;
+	uint32 buckets[PLUGINPERF_BUCKETS];
+};
+
+static const char *pluginperf_plugin = NULL; // Name of the plugin this copy belongs to
+static struct pluginperf_histogram *pluginperf_list[PLUGINPERF_MAX_HOOKS];
+static int pluginperf_count = 0;
+
+static inline uint64 pluginperf_now(void)
+{
+#ifdef WIN32
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER now;
+
+	if (frequency.QuadPart == 0)
+		QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&now);
+	return (uint64)(now.QuadPart / frequency.QuadPart * 1000000000
+		+ now.QuadPart % frequency.QuadPart * 1000000000 / frequency.QuadPart);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static inline int pluginperf_bucket(uint64 value)
+{
+	int exponent;
+
+	if (value < PLUGINPERF_SUB_COUNT)
+		return (int)value;
+#if defined(__GNUC__)
+	exponent = 63 - __builtin_clzll(value);
+#else
+	for (exponent = 0; (value >> exponent) > 1; exponent++)
+		;
+#endif
+	return (exponent - PLUGINPERF_SUB_BITS + 1) * PLUGINPERF_SUB_COUNT
+		+ (int)((value >> (exponent - PLUGINPERF_SUB_BITS)) & (PLUGINPERF_SUB_COUNT - 1));
+}
+
+// Highest latency that falls in a bucket
+static inline uint64 pluginperf_bucket_high(int bucket)
+{
+	int exponent = bucket / PLUGINPERF_SUB_COUNT + PLUGINPERF_SUB_BITS - 1;
+	uint64 width;
+
+	if (bucket < PLUGINPERF_SUB_COUNT)
+		return bucket;
+	width = (uint64)1 << (exponent - PLUGINPERF_SUB_BITS);
+	return ((uint64)(PLUGINPERF_SUB_COUNT + bucket % PLUGINPERF_SUB_COUNT) << (exponent - PLUGINPERF_SUB_BITS)) + width - 1;
+}
+
+static inline void pluginperf_record(struct pluginperf_histogram *h, uint64 ns)
+{
+	if (h->count == 0 || ns < h->min)
+		h->min = ns;
+	if (ns > h->max)
+		h->max = ns;
+	h->count++;
+	h->sum += ns;
+	h->buckets[pluginperf_bucket(ns)]++;
+}
+
+// Runs `call`, a statement such as "ret = mob_dead_mine(md, src, type)", and records how long
+// it took into the histogram `hist` while pluginperf_enabled. Disabled, it costs one branch.
+#define PLUGINPERF_TIME(hist, call) do { \
+	if (!pluginperf_enabled) { \
+		call; \
+	} else { \
+		uint64 pluginperf_start_ = pluginperf_now(); \
+		call; \
+		pluginperf_record(&(hist), pluginperf_now() - pluginperf_start_); \
+	} \
+} while (0)
+
+// Latency at or below which `permille` of the samples are, within a bucket
+static uint64 pluginperf_percentile(const struct pluginperf_histogram *h, int permille)
+{
+	uint64 wanted = (h->count * permille + 999) / 1000, seen = 0;
+	int i;
+
+	for (i = 0; i < PLUGINPERF_BUCKETS; i++) {
+		if ((seen += h->buckets[i]) >= wanted && seen > 0)
+			return min(pluginperf_bucket_high(i), h->max);
+	}
+	return h->max;
+}
+
+static const char *pluginperf_format(char *buf, size_t size, uint64 ns)
+{
+	if (ns < 10000)
+		snprintf(buf, size, "%uns", (unsigned int)ns);
+	else if (ns < 10000000)
+		snprintf(buf, size, "%.1fus", ns / 1000.);
+	else
+		snprintf(buf, size, "%.1fms", ns / 1000000.);
+	return buf;
+}
+
+static void pluginperf_summary(const struct pluginperf_histogram *h, char *out, size_t size)
+{
+	char p50[16], p90[16], p99[16], p999[16], max_[16];
+
+	if (h->count == 0) {
+		snprintf(out, size, "%s: no calls", h->name);
+		return;
+	}
+	snprintf(out, size, "%s: %"PRIu64" calls, p50 %s, p90 %s, p99 %s, p99.9 %s, max %s", h->name, h->count,
+		pluginperf_format(p50, sizeof(p50), pluginperf_percentile(h, 500)),
+		pluginperf_format(p90, sizeof(p90), pluginperf_percentile(h, 900)),
+		pluginperf_format(p99, sizeof(p99), pluginperf_percentile(h, 990)),
+		pluginperf_format(p999, sizeof(p999), pluginperf_percentile(h, 999)),
+		pluginperf_format(max_, sizeof(max_), h->max));
+}
+
+// Every plugin sees "@pluginperf" here and answers for its own hooks. The command is not
+// registered anywhere, so each of them stops the original atcommand->exec. Only players
+// allowed to use every command (or scripts) can use it.
+static bool pluginperf_exec_pre(const int *fd, struct map_session_data **sd, const char **message, bool *player_invoked)
+{
+	const char *args = *message;
+	char output[CHAT_SIZE_MAX];
+	int i;
+
+	if (args == NULL || args[0] != atcommand->at_symbol || strncmpi(args + 1, "pluginperf", 10) != 0
+	 || (args[11] != '\0' && !ISSPACE(args[11])))
+		return false;
+	if (*player_invoked && !pc_has_permission(*sd, PC_PERM_USE_ALL_COMMANDS))
+		return false; // atcommand->exec answers as for any unknown command
+	hookStop();
+
+	for (args += 11; ISSPACE(*args); args++)
+		;
+	if (strcmpi(args, "on") == 0 || strcmpi(args, "off") == 0) {
+		pluginperf_enabled = (strcmpi(args, "on") == 0);
+		snprintf(output, sizeof(output), "%s: hook timing %s.", pluginperf_plugin, pluginperf_enabled ? "on" : "off");
+		clif->message(*fd, output);
+		return true;
+	}
+	if (strcmpi(args, "reset") == 0) {
+		for (i = 0; i < pluginperf_count; i++) {
+			const char *name = pluginperf_list[i]->name;
+
+			memset(pluginperf_list[i], 0, sizeof(*pluginperf_list[i]));
+			pluginperf_list[i]->name = name;
+		}
+		snprintf(output, sizeof(output), "%s: histograms cleared.", pluginperf_plugin);
+		clif->message(*fd, output);
+		return true;
+	}
+
+	snprintf(output, sizeof(output), "------ %s (timing %s) ------", pluginperf_plugin, pluginperf_enabled ? "on" : "off");
+	clif->message(*fd, output);
+	for (i = 0; i < pluginperf_count; i++) {
+		pluginperf_summary(pluginperf_list[i], output, sizeof(output));
+		clif->message(*fd, output);
+	}
+	return true;
+}
+
+static void pluginperf_init(const char *plugin)
+{
+	pluginperf_plugin = plugin;
+	addHookPre(atcommand, exec, pluginperf_exec_pre);
+}
+
+static void pluginperf_register(struct pluginperf_histogram *h, const char *name)
+{
+	h->name = name;
+	if (pluginperf_count < PLUGINPERF_MAX_HOOKS)
+		pluginperf_list[pluginperf_count++] = h;
+}
+
+// Appends the histograms that have samples, with every non-empty bucket, to PLUGINPERF_FILE
+static void pluginperf_dump(void)
+{
+	char summary[CHAT_SIZE_MAX], date[32];
+	time_t now = time(NULL);
+	FILE *fp = NULL;
+	int i, j;
+
+	for (i = 0; i < pluginperf_count; i++) {
+		const struct pluginperf_histogram *h = pluginperf_list[i];
+
+		if (h->count == 0)
+			continue;
+		if (fp == NULL) {
+			if ((fp = fopen(PLUGINPERF_FILE, "a")) == NULL) {
+				ShowError("%s: can't write '%s'.\n", pluginperf_plugin, PLUGINPERF_FILE);
+				return;
+			}
+			strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&now));
+			fprintf(fp, "== %s, %s\n", pluginperf_plugin, date);
+		}
+		pluginperf_summary(h, summary, sizeof(summary));
+		fprintf(fp, "%s, mean %"PRIu64"ns, min %"PRIu64"ns\n", summary, h->sum / h->count, h->min);
+		for (j = 0; j < PLUGINPERF_BUCKETS; j++) {
+			if (h->buckets[j] != 0)
+				fprintf(fp, "\t<= %"PRIu64"ns\t%u\n", pluginperf_bucket_high(j), h->buckets[j]);
+		}
+	}
+	if (fp != NULL)
+		fclose(fp);
+}
+
+#endif /* PLUGINPERF_H */
@@ -0,0 +1,72 @@
+//===== Plugin bench =========================================
+//= bench.h
+//===== Description: =========================================
+//= What the benchmark drivers use of the stand-in map-server:
+//= building a world, moving its clock and timing the hooks.
+//===== Additional Comments: =================================
+//= See bench/README.md.
+//============================================================
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "common/hercules.h"
+#include "map/homunculus.h"
+#include "map/map.h"
+#include "map/mob.h"
+#include "map/pc.h"
+
+#include <stdio.h>
+#include <time.h>
+
+// What the stand-in server counted since the last bench_counters_reset()
+struct bench_counters {
+	uint64 packets; // Sent to one connection, an area packet counts once per player in the area
+	uint64 bytes;
+	uint64 messages; // clif->message lines
+	uint64 path_searches; // path->search calls that reached the stand-in
+	uint64 flooritems; // Items put on the floor
+	uint64 pickups; // Items taken from the floor before they expired
+	uint64 kills;
+	uint64 thinks; // mob->ai_sub_hard calls made by mob->ai_hard
+	uint64 levelups;
+	uint64 exp_gained;
+};
+
+extern struct bench_counters bench_count;
+
+// Setup and teardown, in this order
+void bench_init(int argc, char **argv);
+void bench_plugin_init(void); // plugin_init, then server_online as the map-server does
+void bench_plugin_final(void);
+
+// World
+int16 bench_add_map(const char *name, int16 xs, int16 ys);
+void bench_add_mob_db(int class_, const char *name, int level, uint32 mode, int hp, int range2, int range3);
+struct map_session_data *bench_add_pc(int16 m, int16 x, int16 y);
+struct mob_data *bench_add_mob(int class_, int16 m, int16 x, int16 y);
+struct homun_data *bench_add_homun(struct map_session_data *sd, int class_, int level);
+void bench_del_homun(struct map_session_data *sd); // Through homun->delete, as when it is deleted in game
+int bench_drop_item(int nameid, int16 m, int16 x, int16 y);
+void bench_wall(int16 m, int16 x0, int16 y0, int16 x1, int16 y1); // Makes the box unwalkable
+
+// Time
+int64 bench_tick(int ms); // Moves the clock and runs the timers that are due
+bool bench_command(struct map_session_data *sd, const char *command); // Runs it as the player, through atcommand->exec
+void bench_echo(bool on); // Print the clif->message lines on stdout
+int bench_scale(int n); // n times the -s factor given on the command line
+
+// Reporting
+static inline uint64 bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void bench_counters_reset(void);
+void bench_header(const char *title);
+void bench_result(const char *name, uint64 calls, uint64 ns);
+void bench_note(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+#endif /* BENCH_H */
@@ -0,0 +1,104 @@
+//===== Plugin bench =========================================
+//= bench_aegisdroprate.c
+//===== Description: =========================================
+//= aegisdroprate.c: mob->drop_adjust against the stock one, on
+//= its own and inside mob deaths.
+//============================================================
+#include "bench.h"
+
+#include "common/memmgr.h"
+#include "map/battle.h"
+#include "map/status.h"
+
+#include <stdlib.h>
+
+static const int drop_rates[] = { 1, 5, 10, 50, 100, 400, 1000, 2500, 5000, 7000, 10000 };
+static const int rate_adjusts[] = { 100, 50, 150, 200, 300, 1000 };
+
+static uint64 bench_drop_adjust(unsigned int (*drop_adjust)(int, int, unsigned short, unsigned short), int calls, uint64 *sum)
+{
+	uint64 start = bench_now();
+	int i;
+
+	for (i = 0; i < calls; i++) {
+		int baserate = drop_rates[i % ARRAYLENGTH(drop_rates)];
+		int rate_adjust = rate_adjusts[i / ARRAYLENGTH(drop_rates) % ARRAYLENGTH(rate_adjusts)];
+
+		*sum += drop_adjust(baserate, rate_adjust, battle->bc->item_drop_adddrop_min, battle->bc->item_drop_adddrop_max);
+	}
+	return bench_now() - start;
+}
+
+// Kills every mob once and respawns them, as many times as it takes
+static uint64 bench_kills(struct map_session_data *sd, struct mob_data **mobs, int mob_count, int kills)
+{
+	uint64 start = bench_now(), ns;
+	int i;
+
+	for (i = 0; i < kills; i++) {
+		struct mob_data *md = mobs[i % mob_count];
+
+		if (md->bl.prev == NULL)
+			mob->spawn(md);
+		status->damage(&sd->bl, &md->bl, md->status.hp, 0, 0, 0);
+		if (i % mob_count == mob_count - 1)
+			bench_tick(1000); // Floor items expire
+	}
+	ns = bench_now() - start;
+	bench_tick(60000); // The next run starts with an empty floor
+	return ns;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int (*stock_drop_adjust)(int, int, unsigned short, unsigned short);
+	unsigned int (*plugin_drop_adjust)(int, int, unsigned short, unsigned short);
+	struct map_session_data *sd;
+	struct mob_data **mobs;
+	int calls, kills, mob_count = 200, i;
+	uint64 stock_sum = 0, plugin_sum = 0, ns;
+	int16 m;
+
+	bench_init(argc, argv);
+	calls = bench_scale(5000000);
+	kills = bench_scale(20000);
+
+	m = bench_add_map("prt_fild08", 200, 200);
+	bench_add_mob_db(1002, "Poring", 1, MD_CANMOVE|MD_LOOTER, 50, 10, 12);
+	sd = bench_add_pc(m, 100, 100);
+	CREATE(mobs, struct mob_data *, mob_count);
+	for (i = 0; i < mob_count; i++)
+		mobs[i] = bench_add_mob(1002, m, 20 + i % 20 * 8, 20 + i / 20 * 16);
+
+	stock_drop_adjust = mob->drop_adjust;
+	bench_plugin_init();
+	plugin_drop_adjust = mob->drop_adjust;
+
+	bench_header("mob->drop_adjust");
+	ns = bench_drop_adjust(stock_drop_adjust, calls, &stock_sum);
+	bench_result("stock mob_drop_adjust", calls, ns);
+	ns = bench_drop_adjust(plugin_drop_adjust, calls, &plugin_sum);
+	bench_result("aegisdroprate", calls, ns);
+	bench_command(sd, "@pluginperf on");
+	ns = bench_drop_adjust(plugin_drop_adjust, calls, &plugin_sum);
+	bench_result("aegisdroprate, @pluginperf on", calls, ns);
+	bench_command(sd, "@pluginperf off");
+	bench_note("Average drop rate: %.2f stock, %.2f aegisdroprate (per 10000)",
+	           (double)stock_sum / calls, (double)plugin_sum / (2.0 * calls));
+
+	bench_header("mob deaths (mob->dead, normal drops)");
+	mob->drop_adjust = stock_drop_adjust;
+	bench_counters_reset();
+	ns = bench_kills(sd, mobs, mob_count, kills);
+	bench_result("stock mob_drop_adjust", kills, ns);
+	bench_note("%"PRIu64" items dropped", bench_count.flooritems);
+	mob->drop_adjust = plugin_drop_adjust;
+	bench_counters_reset();
+	ns = bench_kills(sd, mobs, mob_count, kills);
+	bench_result("aegisdroprate", kills, ns);
+	bench_note("%"PRIu64" items dropped", bench_count.flooritems);
+
+	bench_plugin_final();
+	aFree(mobs);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+//===== Plugin bench =========================================
+//= bench_dropannouncerate.c
+//===== Description: =========================================
+//= dropannouncerate.c: mob deaths through the plugin's mob->dead
+//= against the stock one, with a party of attackers per mob.
+//============================================================
+#include "bench.h"
+
+#include "common/memmgr.h"
+#include "common/timer.h"
+#include "map/status.h"
+
+#include <stdlib.h>
+
+extern int rate_announce;
+
+// Kills every mob once and respawns them, as many times as it takes.
+// Each mob is hit by every player first, so mob->dead shares exp and picks the first looter.
+static uint64 bench_kills(struct map_session_data **pcs, int pc_count, struct mob_data **mobs, int mob_count, int kills)
+{
+	uint64 start = bench_now(), ns;
+	int i, j;
+
+	for (i = 0; i < kills; i++) {
+		struct mob_data *md = mobs[i % mob_count];
+
+		if (md->bl.prev == NULL)
+			mob->spawn(md);
+		for (j = 0; j < pc_count - 1; j++)
+			status->damage(&pcs[j]->bl, &md->bl, md->status.max_hp / (pc_count * 2), 0, 0, 0);
+		status->damage(&pcs[pc_count - 1]->bl, &md->bl, md->status.hp, 0, 0, 0);
+		if (i % mob_count == mob_count - 1)
+			bench_tick(1000); // Floor items expire, announcement batches go out
+	}
+	ns = bench_now() - start;
+	bench_tick(60000); // The next run starts with an empty floor
+	return ns;
+}
+
+int main(int argc, char **argv)
+{
+	int (*stock_dead)(struct mob_data *md, struct block_list *src, int type);
+	int (*plugin_dead)(struct mob_data *md, struct block_list *src, int type);
+	struct map_session_data *pcs[6];
+	struct mob_data **mobs;
+	int kills, mob_count = 200, i;
+	uint64 ns;
+	int16 m;
+
+	bench_init(argc, argv);
+	kills = bench_scale(20000);
+
+	m = bench_add_map("gef_fild10", 200, 200);
+	bench_add_mob_db(1023, "Orc Warrior", 24, MD_CANMOVE|MD_AGGRESSIVE|MD_CANATTACK, 1400, 10, 12);
+	for (i = 0; i < ARRAYLENGTH(pcs); i++)
+		pcs[i] = bench_add_pc(m, 96 + i, 100);
+	CREATE(mobs, struct mob_data *, mob_count);
+	for (i = 0; i < mob_count; i++)
+		mobs[i] = bench_add_mob(1023, m, 20 + i % 20 * 8, 20 + i / 20 * 16);
+
+	stock_dead = mob->dead;
+	bench_plugin_init();
+	plugin_dead = mob->dead;
+
+	bench_header("mob deaths, 6 attackers each");
+	mob->dead = stock_dead;
+	bench_counters_reset();
+	ns = bench_kills(pcs, ARRAYLENGTH(pcs), mobs, mob_count, kills);
+	bench_result("stock mob_dead", kills, ns);
+	bench_note("%"PRIu64" items dropped, %"PRIu64" packets", bench_count.flooritems, bench_count.packets);
+
+	mob->dead = plugin_dead;
+	bench_counters_reset();
+	ns = bench_kills(pcs, ARRAYLENGTH(pcs), mobs, mob_count, kills);
+	bench_result("dropannouncerate", kills, ns);
+	bench_note("%"PRIu64" items dropped, %"PRIu64" packets", bench_count.flooritems, bench_count.packets);
+
+	bench_command(pcs[0], "@pluginperf on");
+	bench_counters_reset();
+	ns = bench_kills(pcs, ARRAYLENGTH(pcs), mobs, mob_count, kills);
+	bench_result("dropannouncerate, @pluginperf on", kills, ns);
+
+	bench_header("@pluginperf");
+	bench_echo(true);
+	bench_command(pcs[0], "@pluginperf");
+	bench_echo(false);
+	bench_note("rate_announce = %d", rate_announce);
+
+	bench_plugin_final();
+	aFree(mobs);
+	return EXIT_SUCCESS;
+}
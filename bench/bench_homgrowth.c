@@ -0,0 +1,109 @@
+//===== Plugin bench =========================================
+//= bench_homgrowth.c
+//===== Description: =========================================
+//= @homgrowth.c: homunculus level-ups and evolutions through the
+//= plugin's hooks, @homgrowth reports, @homaudit and
+//= @reloadhomgrowth.
+//============================================================
+#include "bench.h"
+
+#include <stdlib.h>
+
+extern int homgrowth_history_save;
+
+#define PC_COUNT 200
+
+static const int homun_classes[] = { 6001, 6002, 6003, 6004 };
+static struct map_session_data *pcs[PC_COUNT];
+
+// Every player gets a new level 1 homunculus and raises it to 99
+static uint64 bench_levelups(void)
+{
+	uint64 start;
+	int i;
+
+	for (i = 0; i < PC_COUNT; i++) {
+		bench_del_homun(pcs[i]);
+		bench_add_homun(pcs[i], homun_classes[i % ARRAYLENGTH(homun_classes)], 1);
+	}
+	start = bench_now();
+	for (i = 0; i < PC_COUNT; i++) {
+		while (pcs[i]->hd->homunculus.level < 99)
+			homun->gainexp(pcs[i]->hd, pcs[i]->hd->exp_next);
+	}
+	return bench_now() - start;
+}
+
+static uint64 bench_commands(const char *command, int calls)
+{
+	uint64 start = bench_now();
+	int i;
+
+	for (i = 0; i < calls; i++)
+		bench_command(pcs[i % PC_COUNT], command);
+	return bench_now() - start;
+}
+
+int main(int argc, char **argv)
+{
+	int passes, calls, i;
+	uint64 ns, messages;
+	int16 m;
+
+	bench_init(argc, argv);
+	passes = bench_scale(5);
+	calls = bench_scale(20000);
+
+	m = bench_add_map("prontera", 300, 300);
+	for (i = 0; i < PC_COUNT; i++)
+		pcs[i] = bench_add_pc(m, 20 + i % 20 * 13, 20 + i / 20 * 13);
+
+	homgrowth_history_save = 0; // No saves in the middle of the measurements
+	bench_plugin_init();
+
+	bench_header("level-ups (homun->levelup pre and post-hooks)");
+	bench_counters_reset();
+	for (i = 0, ns = 0; i < passes; i++)
+		ns += bench_levelups();
+	bench_result("level 1 to 99", bench_count.levelups, ns);
+
+	bench_header("@homgrowth, 200 players with a level 99 homunculus");
+	bench_command(pcs[0], "@pluginperf on");
+	bench_counters_reset();
+	ns = bench_commands("@homgrowth", calls);
+	bench_result("@homgrowth", calls, ns);
+	bench_note("%.1f messages, %.0f bytes per report", (double)bench_count.messages / calls, (double)bench_count.bytes / calls);
+
+	bench_counters_reset();
+	ns = bench_commands("@homgrowth history", calls);
+	bench_result("@homgrowth history", calls, ns);
+	bench_note("%.1f messages, %.0f bytes per report", (double)bench_count.messages / calls, (double)bench_count.bytes / calls);
+
+	for (i = 0; i < PC_COUNT; i++)
+		homun->evolve(pcs[i]->hd);
+	bench_counters_reset();
+	ns = bench_commands("@homgrowth", calls);
+	bench_result("@homgrowth, evolved", calls, ns);
+
+	bench_header("@homaudit, @reloadhomgrowth");
+	bench_counters_reset();
+	ns = bench_now();
+	bench_command(pcs[0], "@homaudit");
+	for (i = 0, messages = bench_count.messages; i < 600 && bench_count.messages == messages; i++)
+		bench_tick(100); // Polled every 100ms until the workers are done
+	ns = bench_now() - ns;
+	bench_result("@homaudit", 1, ns);
+
+	ns = bench_now();
+	bench_command(pcs[0], "@reloadhomgrowth");
+	bench_result("@reloadhomgrowth", 1, bench_now() - ns);
+
+	bench_header("@pluginperf");
+	bench_echo(true);
+	bench_command(pcs[0], "@homgrowth");
+	bench_command(pcs[0], "@pluginperf");
+	bench_echo(false);
+
+	bench_plugin_final();
+	return EXIT_SUCCESS;
+}
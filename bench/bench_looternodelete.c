@@ -0,0 +1,317 @@
+//===== Plugin bench =========================================
+//= bench_looternodelete.c
+//===== Description: =========================================
+//= looternodelete.c: server ticks of mob AI through the plugin's
+//= mob->ai_sub_hard, on a field of looters and aggressive mobs
+//= with players fighting them, items on the floor, stuns and
+//= walls coming and going. Then the same on a 20000 mob field,
+//= and the target and attacker checks of its mobs through
+//= ai_target_handle against map->id2bl.
+//===== Additional Comments: =================================
+//= The plugin is included, so its handles can be timed alone.
+//============================================================
+#include "bench.h"
+
+#include "looternodelete.c"
+
+#include <stdlib.h>
+
+// A map with its players and mobs
+struct bench_field {
+	int16 m;
+	int16 size;
+	int pc_count;
+	struct map_session_data **pcs;
+	int mob_count;
+	struct mob_data **mobs;
+};
+
+static struct bench_field field, field_20k;
+
+static int bench_pick_target(struct block_list *bl, va_list ap)
+{
+	struct block_list **target = va_arg(ap, struct block_list **);
+
+	if (*target == NULL || rnd() % 4 == 0)
+		*target = bl;
+	return 0;
+}
+
+// A fly wing: off the map and back on at a random free cell of the field, whichever map the player was on
+static void bench_warp(struct bench_field *f, struct map_session_data *sd)
+{
+	int16 x, y;
+
+	do {
+		x = 10 + rnd() % (f->size - 20);
+		y = 10 + rnd() % (f->size - 20);
+	} while (map->getcell(f->m, &sd->bl, x, y, CELL_CHKNOPASS));
+	unit->stop_attack(&sd->bl);
+	unit->stop_walking(&sd->bl, 1);
+	sd->ud.target = sd->ud.target_to = 0;
+	map->delblock(&sd->bl);
+	sd->bl.m = f->m;
+	sd->bl.x = x;
+	sd->bl.y = y;
+	map->addblock(&sd->bl);
+}
+
+// Looters and aggressive mobs, two to one, spread over the field
+static void bench_field_init(struct bench_field *f, const char *name, int16 size, int pc_count, int mob_count)
+{
+	int i;
+
+	f->m = bench_add_map(name, size, size);
+	f->size = size;
+	f->pc_count = pc_count;
+	f->mob_count = mob_count;
+	CREATE(f->pcs, struct map_session_data *, pc_count);
+	CREATE(f->mobs, struct mob_data *, mob_count);
+	bench_wall(f->m, size / 5, size / 5, size * 3 / 10, size * 9 / 40);
+	bench_wall(f->m, size * 7 / 10, size * 3 / 5, size * 29 / 40, size * 17 / 20);
+	bench_wall(f->m, size * 3 / 20, size * 3 / 4, size * 2 / 5, size * 19 / 25);
+	for (i = 0; i < mob_count; i++) {
+		int class_ = i % 3 != 2 ? 1113 : (i % 2 ? 1068 : 1109);
+
+		f->mobs[i] = bench_add_mob(class_, f->m, 10 + rnd() % (size - 20), 10 + rnd() % (size - 20));
+	}
+}
+
+// One server tick of what happens around the mobs, then the tick itself
+static void bench_server_tick(struct bench_field *f, int n)
+{
+	int i;
+
+	// Players and monsters drop things, 20 a tick on 200x200 cells
+	for (i = 0; i < f->size * f->size / 2000; i++)
+		bench_drop_item(501 + rnd() % 100, f->m, rnd() % f->size, rnd() % f->size);
+
+	// Players fly somewhere else now and then, and pick a mob near them when done with the last one
+	for (i = 0; i < f->pc_count; i++) {
+		struct map_session_data *sd = f->pcs[i];
+		struct block_list *target = NULL;
+
+		if ((n + i * 5) % 100 == 0)
+			bench_warp(f, sd);
+		if (sd->ud.target != 0 || (n + i) % 30 != 0)
+			continue;
+		map->foreachinrange(bench_pick_target, &sd->bl, 9, BL_MOB, &target);
+		if (target != NULL)
+			unit->attack(&sd->bl, target->id, 1);
+	}
+
+	// Stuns from player skills, 10 every 20 ticks for 600 mobs
+	if (n % 20 == 0) {
+		for (i = 0; i < f->mob_count / 60; i++) {
+			struct mob_data *md = f->mobs[rnd() % f->mob_count];
+
+			if (md->bl.prev != NULL)
+				status->change_start(NULL, &md->bl, SC_STUN, 10000, 1, 0, 0, 0, 3000, 0, 0);
+		}
+	}
+
+	// A door opens and closes: a wall across the middle of the map
+	if (n % 50 == 0) {
+		if (n % 100 == 0)
+			bench_wall(f->m, f->size / 2, 20, f->size / 2, f->size - 20);
+		else
+			for (i = 20; i <= f->size - 20; i++)
+				map->setcell(f->m, f->size / 2, i, CELL_WALKABLE, true);
+	}
+
+	bench_tick(MIN_MOBTHINKTIME);
+}
+
+static uint64 bench_ticks(struct bench_field *f, int ticks)
+{
+	uint64 start = bench_now();
+	int i;
+
+	for (i = 0; i < ticks; i++)
+		bench_server_tick(f, i);
+	return bench_now() - start;
+}
+
+static void bench_report(const char *name, int ticks, uint64 ns)
+{
+	bench_result(name, ticks, ns);
+	if (bench_count.thinks != 0)
+		bench_note("%"PRIu64" thinks, %.1f ns/think, %"PRIu64" path searches, %"PRIu64" pickups, %"PRIu64" kills",
+		           bench_count.thinks, (double)ns / bench_count.thinks, bench_count.path_searches, bench_count.pickups, bench_count.kills);
+}
+
+// What leaves the ID database between two passes: floor items picked up or expired
+// (transient) and units (mobs dying, players leaving)
+struct bench_churn {
+	const char *name;
+	int transient; // Per pass
+	int unit_every; // A unit every that many passes, 0 for none
+};
+
+// The target and attacker checks of every mob of the field, as a think starts with them:
+// map->id2bl(md->target_id) and map->id2bl(md->attacked_id) against the plugin's handles.
+// A pass checks every mob once. The churn goes through map->deliddb, so it bumps the
+// generations as on a server.
+static void bench_handles(struct bench_field *f, int passes)
+{
+	static const struct bench_churn churns[] = {
+		{ "ai_target_handle", 0, 0 },
+		{ "ai_target_handle, 20 items gone a pass", 20, 0 },
+		{ "ai_target_handle, a unit gone every 10", 0, 10 },
+		{ "ai_target_handle, a unit gone a pass", 0, 1 },
+	};
+	struct mob_ai_data **ads;
+	int *target_ids, *attacked_ids;
+	struct block_list gone = { 0 };
+	uint64 start, ns, found, found_id2bl;
+	int pass, i, c, k;
+
+	CREATE(ads, struct mob_ai_data *, f->mob_count);
+	CREATE(target_ids, int, f->mob_count);
+	CREATE(attacked_ids, int, f->mob_count);
+	for (i = 0; i < f->mob_count; i++) {
+		struct mob_data *md = f->mobs[i];
+
+		target_ids[i] = md->target_id;
+		attacked_ids[i] = md->attacked_id;
+		md->target_id = f->mobs[rnd() % f->mob_count]->bl.id;
+		md->attacked_id = f->pcs[rnd() % f->pc_count]->bl.id;
+		ads[i] = mob_ai_data(md, true);
+	}
+
+	found = 0;
+	start = bench_now();
+	for (pass = 0; pass < passes; pass++) {
+		for (i = 0; i < f->mob_count; i++) {
+			const struct mob_data *md = f->mobs[i];
+
+			found += (map->id2bl(md->target_id) != NULL) + (map->id2bl(md->attacked_id) != NULL);
+		}
+	}
+	ns = bench_now() - start;
+	bench_result("map->id2bl", (uint64)passes * f->mob_count, ns);
+	bench_note("a call checks the target and the attacker of one mob");
+	found_id2bl = found;
+
+	for (c = 0; c < ARRAYLENGTH(churns); c++) {
+		found = 0;
+		start = bench_now();
+		for (pass = 0; pass < passes; pass++) {
+			// Ids that were never in the database, only the generations move
+			gone.id = -1;
+			gone.type = BL_ITEM;
+			for (k = 0; k < churns[c].transient; k++)
+				map->deliddb(&gone);
+			gone.type = BL_MOB;
+			if (churns[c].unit_every != 0 && pass % churns[c].unit_every == 0)
+				map->deliddb(&gone);
+			for (i = 0; i < f->mob_count; i++) {
+				struct mob_data *md = f->mobs[i];
+
+				found += (ai_handle_get(&ads[i]->target, md->target_id) != NULL)
+				       + (ai_handle_get(&ads[i]->attacker, md->attacked_id) != NULL);
+			}
+		}
+		ns = bench_now() - start;
+		bench_result(churns[c].name, (uint64)passes * f->mob_count, ns);
+		if (found != found_id2bl)
+			bench_note("found %"PRIu64" targets, map->id2bl found %"PRIu64, found, found_id2bl);
+	}
+
+	for (i = 0; i < f->mob_count; i++) {
+		f->mobs[i]->target_id = target_ids[i];
+		f->mobs[i]->attacked_id = attacked_ids[i];
+	}
+	aFree(ads);
+	aFree(target_ids);
+	aFree(attacked_ids);
+}
+
+int main(int argc, char **argv)
+{
+	bool (*stock_ai)(struct mob_data *md, int64 tick);
+	bool (*plugin_ai)(struct mob_data *md, int64 tick);
+	int ticks, i;
+	uint64 ns;
+
+	bench_init(argc, argv);
+	ticks = bench_scale(3000);
+
+	bench_add_mob_db(1113, "Drops", 3, MD_CANMOVE|MD_LOOTER|MD_CANATTACK, 5000, 10, 12);
+	bench_add_mob_db(1068, "Hydra", 14, MD_AGGRESSIVE|MD_CANATTACK|MD_CHANGETARGET_MELEE, 5000, 7, 7);
+	bench_add_mob_db(1109, "Deviruchi", 46, MD_CANMOVE|MD_LOOTER|MD_AGGRESSIVE|MD_CANATTACK|MD_CHANGETARGET_CHASE, 5000, 10, 12);
+	bench_field_init(&field, "moc_fild07", 200, 20, 600);
+	for (i = 0; i < field.pc_count; i++)
+		field.pcs[i] = bench_add_pc(field.m, 20 + i % 5 * 40, 20 + i / 5 * 45);
+	// No players on it until the first field is done, so its mobs don't think meanwhile
+	bench_field_init(&field_20k, "moc_fild08", 400, 100, 20000);
+
+	stock_ai = mob->ai_sub_hard;
+	bench_plugin_init();
+	plugin_ai = mob->ai_sub_hard;
+
+	bench_header("mob AI ticks (100ms), 20 players, 600 mobs");
+	mob->ai_sub_hard = stock_ai;
+	bench_counters_reset();
+	ns = bench_ticks(&field, ticks);
+	bench_report("stand-in only, no AI", ticks, ns);
+
+	mob->ai_sub_hard = plugin_ai;
+	bench_counters_reset();
+	ns = bench_ticks(&field, ticks);
+	bench_report("looternodelete", ticks, ns);
+
+	ai_think_budget = 0;
+	bench_counters_reset();
+	ns = bench_ticks(&field, ticks);
+	bench_report("looternodelete, ai_think_budget 0", ticks, ns);
+	ai_think_budget = 20000;
+
+	bench_command(field.pcs[0], "@pluginperf on");
+	bench_counters_reset();
+	ns = bench_ticks(&field, ticks);
+	bench_report("looternodelete, @pluginperf on", ticks, ns);
+
+	bench_header("@aisched, @pluginperf");
+	bench_echo(true);
+	bench_command(field.pcs[0], "@aisched");
+#ifdef LOOTER_AI_PROFILE
+	bench_command(field.pcs[0], "@aiprof");
+#endif
+	bench_command(field.pcs[0], "@pluginperf");
+	bench_echo(false);
+	bench_command(field.pcs[0], "@pluginperf off");
+
+	// The players of the first field move over and more join them
+	for (i = 0; i < field_20k.pc_count; i++) {
+		if (i < field.pc_count)
+			field_20k.pcs[i] = field.pcs[i];
+		else
+			field_20k.pcs[i] = bench_add_pc(field_20k.m, 20, 20);
+		bench_warp(&field_20k, field_20k.pcs[i]);
+	}
+	ticks = bench_scale(300);
+
+	bench_header("mob AI ticks (100ms), 100 players, 20000 mobs");
+	mob->ai_sub_hard = stock_ai;
+	bench_counters_reset();
+	ns = bench_ticks(&field_20k, ticks);
+	bench_report("stand-in only, no AI", ticks, ns);
+
+	mob->ai_sub_hard = plugin_ai;
+	bench_counters_reset();
+	ns = bench_ticks(&field_20k, ticks);
+	bench_report("looternodelete", ticks, ns);
+
+	ai_think_budget = 0;
+	bench_counters_reset();
+	ns = bench_ticks(&field_20k, ticks);
+	bench_report("looternodelete, ai_think_budget 0", ticks, ns);
+	ai_think_budget = 20000;
+
+	bench_header("target and attacker checks, 20000 mobs");
+	bench_handles(&field_20k, bench_scale(200));
+
+	bench_plugin_final();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,191 @@
+//===== Plugin bench =========================================
+//= bench_mobiddisplay.c
+//===== Description: =========================================
+//= mobiddisplay.c: name requests through the plugin's
+//= clif->mobname_normal_ack against the stock one, and the name
+//= refreshes of mobid_show_status while mobs take damage. Then
+//= the name of a name packet alone: the per-class display names
+//= against the snprintf they replaced.
+//===== Additional Comments: =================================
+//= The plugin is included, so its name building can be timed alone.
+//============================================================
+#include "bench.h"
+
+#include "mobiddisplay.c"
+
+#include <stdlib.h>
+
+#define PC_COUNT 20
+#define MOB_COUNT 400
+#define REQUESTS_PER_TICK 8 // Per player, a client asks again for every mob it scrolls over
+
+static struct map_session_data *pcs[PC_COUNT];
+static struct mob_data *mobs[MOB_COUNT];
+static struct mob_data *named_mobs[MOB_COUNT]; // Spawned with a name of their own
+static volatile uint64 bench_name_sink; // Keeps the names from being optimized out
+
+// Each player asks for the names of the 40 mobs around it, in random order and with repeats
+static uint64 bench_requests(int requests)
+{
+	uint64 start = bench_now();
+	int i;
+
+	for (i = 0; i < requests; i++) {
+		int n = i % PC_COUNT;
+		struct mob_data *md = mobs[(n * 20 + rnd() % 40) % MOB_COUNT];
+
+		clif->mobname_normal_ack(pcs[n]->fd, &md->bl);
+		if (i % (PC_COUNT * REQUESTS_PER_TICK) == PC_COUNT * REQUESTS_PER_TICK - 1)
+			bench_tick(100); // Queued replies go out
+	}
+	bench_tick(100);
+	return bench_now() - start;
+}
+
+// Players hit mobs and mobs heal back, so the HP percent goes up and down
+static uint64 bench_damage(int hits)
+{
+	uint64 start = bench_now();
+	int i;
+
+	for (i = 0; i < hits; i++) {
+		struct mob_data *md = mobs[i % MOB_COUNT];
+
+		if (md->status.hp > md->status.max_hp / 4)
+			status->damage(&pcs[i % PC_COUNT]->bl, &md->bl, md->status.max_hp / 20, 0, 0, 0);
+		else
+			status->heal(&md->bl, md->status.max_hp / 2, 0, 0);
+		if (i % MOB_COUNT == MOB_COUNT - 1)
+			bench_tick(100);
+	}
+	return bench_now() - start;
+}
+
+// The name of a name packet as it was built before the per-class display names.
+// Returns true when the name was cut to NAME_LENGTH.
+static bool bench_name_snprintf(char *name, const struct mob_data *md)
+{
+	char mobidline[NAME_LENGTH];
+	bool cut = (snprintf(mobidline, sizeof(mobidline), "%s [%d]", md->name, md->class_) >= NAME_LENGTH);
+
+	memcpy(name, mobidline, NAME_LENGTH);
+	return cut;
+}
+
+// Names of `calls` packets for the mobs of `set`, built one way or the other
+static uint64 bench_names(struct mob_data **set, int calls, bool plugin)
+{
+	uint64 start = bench_now(), sum = 0;
+	char name[NAME_LENGTH];
+	int i;
+
+	for (i = 0; i < calls; i++) {
+		struct mob_data *md = set[i % MOB_COUNT];
+
+		if (plugin)
+			mobid_packet_name(name, md);
+		else
+			sum += bench_name_snprintf(name, md);
+		sum += (unsigned char)name[i % 16];
+	}
+	bench_name_sink = sum;
+	return bench_now() - start;
+}
+
+static void bench_names_compare(struct mob_data **set, int calls, const char *old_label, const char *new_label)
+{
+	char old_name[NAME_LENGTH], new_name[NAME_LENGTH];
+	int i, differ = 0, cut = 0;
+
+	for (i = 0; i < MOB_COUNT; i++) {
+		cut += bench_name_snprintf(old_name, set[i]);
+		mobid_packet_name(new_name, set[i]);
+		differ += (strncmp(old_name, new_name, NAME_LENGTH) != 0);
+	}
+
+	bench_result(old_label, calls, bench_names(set, calls, false));
+	bench_result(new_label, calls, bench_names(set, calls, true));
+	if (differ != 0)
+		bench_note("%d of %d names differ", differ, MOB_COUNT);
+	if (cut != 0)
+		bench_note("%d of %d names cut to NAME_LENGTH", cut, MOB_COUNT);
+}
+
+int main(int argc, char **argv)
+{
+	void (*stock_ack)(int fd, struct block_list *bl);
+	void (*plugin_ack)(int fd, struct block_list *bl);
+	int requests, hits, i;
+	uint64 ns;
+	int16 m;
+
+	bench_init(argc, argv);
+	requests = bench_scale(1000000);
+	hits = bench_scale(1000000);
+
+	m = bench_add_map("pay_fild04", 240, 240);
+	bench_add_mob_db(1031, "Poporing", 14, MD_CANMOVE|MD_LOOTER, 1000000, 10, 12);
+	for (i = 0; i < PC_COUNT; i++)
+		pcs[i] = bench_add_pc(m, 30 + i % 5 * 45, 30 + i / 5 * 60);
+	for (i = 0; i < MOB_COUNT; i++)
+		mobs[i] = bench_add_mob(1031, m, pcs[i / 20]->bl.x, pcs[i / 20]->bl.y);
+
+	stock_ack = clif->mobname_normal_ack;
+	bench_plugin_init();
+	plugin_ack = clif->mobname_normal_ack;
+
+	bench_header("name requests, 20 players, 8 per player per tick");
+	clif->mobname_normal_ack = stock_ack;
+	bench_counters_reset();
+	ns = bench_requests(requests);
+	bench_result("stock clif_mobname_normal_ack", requests, ns);
+	bench_note("%"PRIu64" packets, %"PRIu64" bytes", bench_count.packets, bench_count.bytes);
+
+	clif->mobname_normal_ack = plugin_ack;
+	bench_counters_reset();
+	ns = bench_requests(requests);
+	bench_result("mobiddisplay", requests, ns);
+	bench_note("%"PRIu64" packets, %"PRIu64" bytes", bench_count.packets, bench_count.bytes);
+
+	mobid_show_status = 1;
+	bench_counters_reset();
+	ns = bench_requests(requests);
+	bench_result("mobiddisplay, mobid_show_status 1", requests, ns);
+	bench_note("%"PRIu64" packets, %"PRIu64" bytes", bench_count.packets, bench_count.bytes);
+
+	bench_command(pcs[0], "@pluginperf on");
+	bench_counters_reset();
+	ns = bench_requests(requests);
+	bench_result("mobiddisplay, @pluginperf on", requests, ns);
+	bench_command(pcs[0], "@pluginperf off");
+
+	bench_header("damage and heal (mob->damage, mob->heal post-hooks)");
+	mobid_show_status = 0;
+	bench_counters_reset();
+	ns = bench_damage(hits);
+	bench_result("mobid_show_status 0", hits, ns);
+	bench_note("%"PRIu64" packets", bench_count.packets);
+	mobid_show_status = 1;
+	bench_counters_reset();
+	ns = bench_damage(hits);
+	bench_result("mobid_show_status 1", hits, ns);
+	bench_note("%"PRIu64" packets", bench_count.packets);
+
+	bench_header("name of a name packet, mobid_show_status 0");
+	mobid_show_status = 0;
+	for (i = 0; i < MOB_COUNT; i++) {
+		named_mobs[i] = bench_add_mob(1031, m, 5, 5);
+		snprintf(named_mobs[i]->name, sizeof(named_mobs[i]->name), "Poporing %d", i);
+	}
+	bench_names_compare(mobs, requests, "snprintf, class names", "mobid_names, class names");
+	bench_names_compare(named_mobs, requests, "snprintf, own names", "mobid_names, own names");
+
+	bench_header("@mobnamestats, @pluginperf");
+	bench_echo(true);
+	bench_command(pcs[0], "@mobnamestats");
+	bench_command(pcs[0], "@pluginperf");
+	bench_echo(false);
+
+	bench_plugin_final();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,775 @@
+//===== Plugin bench =========================================
+//= core.c
+//===== Description: =========================================
+//= Stand-in for the common/ parts of Hercules the plugins use:
+//= DB maps, timers, rnd, sv->readdb, threads, sessions and ERS.
+//===== Additional Comments: =================================
+//= Same behaviour as Hercules where a plugin can tell, simpler
+//= everywhere else. See bench/README.md.
+//============================================================
+#include "common/hercules.h"
+#include "common/db.h"
+#include "common/ers.h"
+#include "common/memmgr.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/strlib.h"
+#include "common/thread.h"
+#include "common/timer.h"
+#include "server.h"
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*==========================================
+ * DB maps: chained hash table, grown when it gets as many entries as buckets
+ *------------------------------------------*/
+struct db_node {
+	union DBKey key;
+	struct DBData data;
+	struct db_node *next;
+};
+
+struct db_map {
+	struct DBMap vtable; // Must be first
+	enum DBType type;
+	enum DBOptions options;
+	struct db_node **buckets;
+	unsigned int bucket_count;
+	unsigned int count;
+};
+
+struct db_iterator {
+	struct DBIterator vtable; // Must be first
+	struct db_map *db;
+	unsigned int bucket;
+	struct db_node *node;
+};
+
+static uint64 db_key_value(const struct db_map *db, union DBKey key)
+{
+	switch (db->type) {
+		case DB_INT: return (uint64)(int64)key.i;
+		case DB_UINT: return key.ui;
+		default: return (uint64)key.i64;
+	}
+}
+
+static unsigned int db_hash(const struct db_map *db, union DBKey key)
+{
+	uint64 h = db_key_value(db, key) * UINT64_C(0x9E3779B97F4A7C15);
+
+	return (unsigned int)(h >> 32) & (db->bucket_count - 1);
+}
+
+static void db_release(struct db_map *db, struct DBData *data)
+{
+	if ((db->options&DB_OPT_RELEASE_DATA) && data->type == DB_DATA_PTR)
+		aFree(data->u.ptr);
+}
+
+static struct db_node *db_find(struct db_map *db, union DBKey key)
+{
+	struct db_node *node;
+	uint64 value = db_key_value(db, key);
+
+	for (node = db->buckets[db_hash(db, key)]; node != NULL; node = node->next) {
+		if (db_key_value(db, node->key) == value)
+			return node;
+	}
+	return NULL;
+}
+
+static void db_grow(struct db_map *db)
+{
+	struct db_node **old = db->buckets;
+	unsigned int old_count = db->bucket_count, i;
+
+	db->bucket_count *= 2;
+	CREATE(db->buckets, struct db_node *, db->bucket_count);
+	for (i = 0; i < old_count; i++) {
+		struct db_node *node, *next;
+
+		for (node = old[i]; node != NULL; node = next) {
+			unsigned int h = db_hash(db, node->key);
+
+			next = node->next;
+			node->next = db->buckets[h];
+			db->buckets[h] = node;
+		}
+	}
+	aFree(old);
+}
+
+static bool db_obj_exists(struct DBMap *self, union DBKey key)
+{
+	return db_find((struct db_map *)self, key) != NULL;
+}
+
+static struct DBData *db_obj_get(struct DBMap *self, union DBKey key)
+{
+	struct db_node *node = db_find((struct db_map *)self, key);
+
+	return node != NULL ? &node->data : NULL;
+}
+
+static int db_obj_put(struct DBMap *self, union DBKey key, struct DBData data, struct DBData *out_data)
+{
+	struct db_map *db = (struct db_map *)self;
+	struct db_node *node = db_find(db, key);
+	unsigned int h;
+
+	if (node != NULL) {
+		if (out_data != NULL)
+			*out_data = node->data;
+		else
+			db_release(db, &node->data);
+		node->data = data;
+		return 1;
+	}
+	if (db->count >= db->bucket_count)
+		db_grow(db);
+	h = db_hash(db, key);
+	CREATE(node, struct db_node, 1);
+	node->key = key;
+	node->data = data;
+	node->next = db->buckets[h];
+	db->buckets[h] = node;
+	db->count++;
+	return 0;
+}
+
+static int db_obj_remove(struct DBMap *self, union DBKey key, struct DBData *out_data)
+{
+	struct db_map *db = (struct db_map *)self;
+	struct db_node **link = &db->buckets[db_hash(db, key)];
+	uint64 value = db_key_value(db, key);
+
+	for (; *link != NULL; link = &(*link)->next) {
+		struct db_node *node = *link;
+
+		if (db_key_value(db, node->key) != value)
+			continue;
+		*link = node->next;
+		if (out_data != NULL)
+			*out_data = node->data;
+		else
+			db_release(db, &node->data);
+		aFree(node);
+		db->count--;
+		return 1;
+	}
+	return 0;
+}
+
+static int db_obj_vclear(struct db_map *db, DBApply func, va_list args)
+{
+	unsigned int i;
+	int sum = 0;
+
+	for (i = 0; i < db->bucket_count; i++) {
+		struct db_node *node, *next;
+
+		for (node = db->buckets[i]; node != NULL; node = next) {
+			next = node->next;
+			if (func != NULL) {
+				va_list argcopy;
+
+				va_copy(argcopy, args);
+				sum += func(node->key, &node->data, argcopy);
+				va_end(argcopy);
+			}
+			db_release(db, &node->data);
+			aFree(node);
+		}
+		db->buckets[i] = NULL;
+	}
+	db->count = 0;
+	return sum;
+}
+
+static int db_obj_clear(struct DBMap *self, DBApply func, ...)
+{
+	va_list args;
+	int sum;
+
+	va_start(args, func);
+	sum = db_obj_vclear((struct db_map *)self, func, args);
+	va_end(args);
+	return sum;
+}
+
+static int db_obj_destroy(struct DBMap *self, DBApply func, ...)
+{
+	struct db_map *db = (struct db_map *)self;
+	va_list args;
+	int sum;
+
+	va_start(args, func);
+	sum = db_obj_vclear(db, func, args);
+	va_end(args);
+	aFree(db->buckets);
+	aFree(db);
+	return sum;
+}
+
+static unsigned int db_obj_size(struct DBMap *self)
+{
+	return ((struct db_map *)self)->count;
+}
+
+static struct DBData *dbit_obj_next(struct DBIterator *self, union DBKey *out_key)
+{
+	struct db_iterator *it = (struct db_iterator *)self;
+
+	if (it->node != NULL)
+		it->node = it->node->next;
+	while (it->node == NULL && ++it->bucket < it->db->bucket_count)
+		it->node = it->db->buckets[it->bucket];
+	if (it->node == NULL)
+		return NULL;
+	if (out_key != NULL)
+		*out_key = it->node->key;
+	return &it->node->data;
+}
+
+static struct DBData *dbit_obj_first(struct DBIterator *self, union DBKey *out_key)
+{
+	struct db_iterator *it = (struct db_iterator *)self;
+
+	it->bucket = 0;
+	it->node = it->db->buckets[0];
+	if (it->node == NULL)
+		return dbit_obj_next(self, out_key);
+	if (out_key != NULL)
+		*out_key = it->node->key;
+	return &it->node->data;
+}
+
+static bool dbit_obj_exists(struct DBIterator *self)
+{
+	return ((struct db_iterator *)self)->node != NULL;
+}
+
+static void dbit_obj_destroy(struct DBIterator *self)
+{
+	aFree(self);
+}
+
+static struct DBIterator *db_obj_iterator(struct DBMap *self)
+{
+	struct db_iterator *it;
+
+	CREATE(it, struct db_iterator, 1);
+	it->vtable.first = dbit_obj_first;
+	it->vtable.next = dbit_obj_next;
+	it->vtable.exists = dbit_obj_exists;
+	it->vtable.destroy = dbit_obj_destroy;
+	it->db = (struct db_map *)self;
+	return &it->vtable;
+}
+
+static struct DBMap *db_alloc(const char *file, const char *func, int line, enum DBType type, enum DBOptions options, unsigned short maxlen)
+{
+	struct db_map *db;
+
+	if (type == DB_STRING || type == DB_ISTRING) {
+		ShowFatalError("db_alloc: string keys are not supported off-server (%s:%d %s).\n", file, line, func);
+		exit(EXIT_FAILURE);
+	}
+	CREATE(db, struct db_map, 1);
+	db->vtable.iterator = db_obj_iterator;
+	db->vtable.exists = db_obj_exists;
+	db->vtable.get = db_obj_get;
+	db->vtable.put = db_obj_put;
+	db->vtable.remove = db_obj_remove;
+	db->vtable.clear = db_obj_clear;
+	db->vtable.destroy = db_obj_destroy;
+	db->vtable.size = db_obj_size;
+	db->type = type;
+	db->options = options;
+	db->bucket_count = 16;
+	CREATE(db->buckets, struct db_node *, db->bucket_count);
+	return &db->vtable;
+}
+
+static union DBKey db_i2key(int key)
+{
+	union DBKey ret;
+
+	memset(&ret, 0, sizeof(ret));
+	ret.i = key;
+	return ret;
+}
+
+static union DBKey db_ui2key(unsigned int key)
+{
+	union DBKey ret;
+
+	memset(&ret, 0, sizeof(ret));
+	ret.ui = key;
+	return ret;
+}
+
+static union DBKey db_i642key(int64 key)
+{
+	union DBKey ret;
+
+	ret.i64 = key;
+	return ret;
+}
+
+static union DBKey db_ui642key(uint64 key)
+{
+	union DBKey ret;
+
+	ret.ui64 = key;
+	return ret;
+}
+
+static struct DBData db_i2data(int data)
+{
+	struct DBData ret;
+
+	ret.type = DB_DATA_INT;
+	ret.u.i = data;
+	return ret;
+}
+
+static struct DBData db_ui2data(unsigned int data)
+{
+	struct DBData ret;
+
+	ret.type = DB_DATA_UINT;
+	ret.u.ui = data;
+	return ret;
+}
+
+static struct DBData db_ptr2data(void *data)
+{
+	struct DBData ret;
+
+	ret.type = DB_DATA_PTR;
+	ret.u.ptr = data;
+	return ret;
+}
+
+static int db_data2i(struct DBData *data)
+{
+	return data != NULL && data->type == DB_DATA_INT ? data->u.i : 0;
+}
+
+static unsigned int db_data2ui(struct DBData *data)
+{
+	return data != NULL && data->type == DB_DATA_UINT ? data->u.ui : 0;
+}
+
+static void *db_data2ptr(struct DBData *data)
+{
+	return data != NULL && data->type == DB_DATA_PTR ? data->u.ptr : NULL;
+}
+
+static struct db_interface db_s = {
+	db_alloc,
+	db_i2key, db_ui2key, db_i642key, db_ui642key,
+	db_i2data, db_ui2data, db_ptr2data,
+	db_data2i, db_data2ui, db_data2ptr,
+};
+struct db_interface *DB = &db_s;
+
+/*==========================================
+ * Timers: binary heap of timer ids on a clock moved by bench_tick
+ *------------------------------------------*/
+static struct TimerData *timer_data = NULL;
+static int timer_data_max = 0, timer_data_num = 0;
+static int *timer_free = NULL, timer_free_num = 0, timer_free_max = 0;
+static int *timer_heap = NULL, timer_heap_num = 0, timer_heap_max = 0;
+static int64 timer_now = 1000000; // Not 0, plugins use 0 for "never"
+
+static int64 timer_gettick(void)
+{
+	return timer_now;
+}
+
+static void timer_heap_push(int tid)
+{
+	int i;
+
+	if (timer_heap_num == timer_heap_max) {
+		timer_heap_max = max(timer_heap_max * 2, 256);
+		RECREATE(timer_heap, int, timer_heap_max);
+	}
+	for (i = timer_heap_num++; i > 0; i = (i - 1) / 2) {
+		int parent = timer_heap[(i - 1) / 2];
+
+		if (timer_data[parent].tick <= timer_data[tid].tick)
+			break;
+		timer_heap[i] = parent;
+	}
+	timer_heap[i] = tid;
+}
+
+static int timer_heap_pop(void)
+{
+	int top = timer_heap[0], last = timer_heap[--timer_heap_num], i = 0;
+
+	for (;;) {
+		int child = 2 * i + 1;
+
+		if (child >= timer_heap_num)
+			break;
+		if (child + 1 < timer_heap_num && timer_data[timer_heap[child + 1]].tick < timer_data[timer_heap[child]].tick)
+			child++;
+		if (timer_data[last].tick <= timer_data[timer_heap[child]].tick)
+			break;
+		timer_heap[i] = timer_heap[child];
+		i = child;
+	}
+	if (timer_heap_num > 0)
+		timer_heap[i] = last;
+	return top;
+}
+
+static int timer_acquire(void)
+{
+	if (timer_free_num > 0)
+		return timer_free[--timer_free_num];
+	if (timer_data_num == timer_data_max) {
+		timer_data_max = max(timer_data_max * 2, 256);
+		RECREATE(timer_data, struct TimerData, timer_data_max);
+	}
+	return timer_data_num++;
+}
+
+static void timer_release(int tid)
+{
+	memset(&timer_data[tid], 0, sizeof(timer_data[tid]));
+	if (timer_free_num == timer_free_max) {
+		timer_free_max = max(timer_free_max * 2, 256);
+		RECREATE(timer_free, int, timer_free_max);
+	}
+	timer_free[timer_free_num++] = tid;
+}
+
+static int timer_add_sub(int64 tick, TimerFunc func, int id, intptr_t data, int interval, unsigned char type)
+{
+	int tid = timer_acquire();
+
+	timer_data[tid].tick = tick;
+	timer_data[tid].func = func;
+	timer_data[tid].id = id;
+	timer_data[tid].data = data;
+	timer_data[tid].interval = interval;
+	timer_data[tid].type = type;
+	timer_heap_push(tid);
+	return tid;
+}
+
+static int timer_add(int64 tick, TimerFunc func, int id, intptr_t data)
+{
+	return timer_add_sub(tick, func, id, data, 1000, TIMER_ONCE_AUTODEL);
+}
+
+static int timer_add_interval(int64 tick, TimerFunc func, int id, intptr_t data, int interval)
+{
+	if (interval < 1) {
+		ShowError("timer_add_interval: invalid interval (tick: %"PRId64" %p[%d] %d %"PRIdPTR").\n", tick, func, id, interval, data);
+		return INVALID_TIMER;
+	}
+	return timer_add_sub(tick, func, id, data, interval, TIMER_INTERVAL);
+}
+
+static const struct TimerData *timer_get(int tid)
+{
+	return tid >= 0 && tid < timer_data_num && timer_data[tid].func != NULL ? &timer_data[tid] : NULL;
+}
+
+// The entry stays in the heap until it's due, so the id isn't reused before then.
+static int timer_do_delete(int tid, TimerFunc func)
+{
+	if (tid < 0 || tid >= timer_data_num || timer_data[tid].func == NULL) {
+		ShowError("timer_do_delete: no such timer %d (%p)\n", tid, func);
+		return -1;
+	}
+	if (timer_data[tid].func != func) {
+		ShowError("timer_do_delete: function mismatch for timer %d (%p != %p)\n", tid, timer_data[tid].func, func);
+		return -2;
+	}
+	timer_data[tid].func = NULL;
+	timer_data[tid].type = TIMER_ONCE_AUTODEL;
+	return 0;
+}
+
+static int timer_perform(int64 tick)
+{
+	int count = 0;
+
+	while (timer_heap_num > 0 && timer_data[timer_heap[0]].tick <= tick) {
+		int tid = timer_heap_pop();
+		struct TimerData *td = &timer_data[tid];
+
+		if (td->func == NULL) {
+			timer_release(tid);
+			continue;
+		}
+		if (td->type&TIMER_INTERVAL) {
+			td->type |= TIMER_REMOVE_HEAP;
+			td->func(tid, tick, td->id, td->data);
+			td = &timer_data[tid]; // The callback may have added timers
+			td->type &= ~TIMER_REMOVE_HEAP;
+			if (td->func == NULL) {
+				timer_release(tid);
+			} else {
+				td->tick += td->interval;
+				if (td->tick <= tick)
+					td->tick = tick + 1;
+				timer_heap_push(tid);
+			}
+		} else {
+			TimerFunc func = td->func;
+
+			td->func = NULL; // timer->get no longer finds it, as in Hercules
+			func(tid, tick, td->id, td->data);
+			timer_release(tid);
+		}
+		count++;
+	}
+	return count;
+}
+
+static int timer_add_func_list(TimerFunc func, char *name)
+{
+	return 0;
+}
+
+static struct timer_interface timer_s = {
+	.gettick = timer_gettick,
+	.gettick_nocache = timer_gettick,
+	.add = timer_add,
+	.add_interval = timer_add_interval,
+	.get = timer_get,
+	.delete = timer_do_delete,
+	.add_func_list = timer_add_func_list,
+	.perform = timer_perform,
+};
+struct timer_interface *timer = &timer_s;
+
+// Moves the clock to tick and runs what is due on the way, in order
+void bench_timer_run(int64 tick)
+{
+	while (timer_heap_num > 0 && timer_data[timer_heap[0]].tick <= tick) {
+		if (timer_data[timer_heap[0]].tick > timer_now)
+			timer_now = timer_data[timer_heap[0]].tick;
+		timer_perform(timer_now);
+	}
+	timer_now = tick;
+}
+
+/*==========================================
+ * rnd: xorshift, seeded with a fixed value so runs are repeatable
+ *------------------------------------------*/
+static uint32 rnd_state = 2463534242U;
+
+void rnd_seed(uint32 seed)
+{
+	rnd_state = seed != 0 ? seed : 2463534242U;
+}
+
+int32 rnd(void)
+{
+	rnd_state ^= rnd_state << 13;
+	rnd_state ^= rnd_state >> 17;
+	rnd_state ^= rnd_state << 5;
+	return (int32)(rnd_state >> 1);
+}
+
+/*==========================================
+ * strlib
+ *------------------------------------------*/
+char *safestrncpy(char *dst, const char *src, size_t n)
+{
+	if (n > 0) {
+		char *d = dst;
+		const char *s = src;
+
+		for (; n > 1 && *s != '\0'; n--)
+			*d++ = *s++;
+		*d = '\0';
+	}
+	return dst;
+}
+
+// Hercules' sv_readdb: comma separated lines, "//" comment lines and blank lines skipped
+static bool sv_readdb(const char *directory, const char *filename, char delim, int mincols, int maxcols, int maxrows, bool (*parseproc)(char *fields[], int columns, int current))
+{
+	char path[1024], line[1024];
+	char **fields;
+	int lines = 0, entries = 0;
+	FILE *fp;
+
+	snprintf(path, sizeof(path), "%s/%s", directory, filename);
+	if ((fp = fopen(path, "r")) == NULL) {
+		ShowError("sv_readdb: can't read %s\n", path);
+		return false;
+	}
+	CREATE(fields, char *, maxcols + 1);
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		char *p = line;
+		int columns;
+
+		lines++;
+		if (line[0] == '/' && line[1] == '/')
+			continue;
+		if (line[0] == '\0' || line[0] == '\n' || line[0] == '\r')
+			continue;
+
+		line[strcspn(line, "\r\n")] = '\0';
+		fields[0] = line;
+		for (columns = 0; p != NULL; columns++) {
+			char *next = strchr(p, delim);
+
+			if (next != NULL)
+				*next++ = '\0';
+			if (columns < maxcols)
+				fields[columns + 1] = p;
+			p = next;
+		}
+		if (columns < mincols) {
+			ShowError("sv_readdb: Insufficient columns in line %d of \"%s\" (found %d, need at least %d).\n", lines, path, columns, mincols);
+			continue;
+		}
+		if (columns > maxcols) {
+			ShowError("sv_readdb: Too many columns in line %d of \"%s\" (found %d, maximum is %d).\n", lines, path, columns, maxcols);
+			continue;
+		}
+		if (entries == maxrows) {
+			ShowError("sv_readdb: Reached the maximum allowed number of entries (%d) when parsing file \"%s\".\n", maxrows, path);
+			break;
+		}
+		if (!parseproc(fields + 1, columns, entries)) {
+			ShowError("sv_readdb: Could not process contents of line %d of \"%s\".\n", lines, path);
+			continue;
+		}
+		entries++;
+	}
+	aFree(fields);
+	fclose(fp);
+	return true;
+}
+
+static struct sv_interface sv_s = {
+	sv_readdb,
+};
+struct sv_interface *sv = &sv_s;
+
+/*==========================================
+ * Threads
+ *------------------------------------------*/
+struct thread_handle {
+	pthread_t thread;
+};
+
+static struct thread_handle *thread_create(threadFunc entry_point, void *param)
+{
+	struct thread_handle *handle;
+
+	CREATE(handle, struct thread_handle, 1);
+	if (pthread_create(&handle->thread, NULL, entry_point, param) != 0) {
+		aFree(handle);
+		return NULL;
+	}
+	return handle;
+}
+
+static bool thread_wait(struct thread_handle *handle, void **out_exit_code)
+{
+	if (handle == NULL || pthread_join(handle->thread, out_exit_code) != 0)
+		return false;
+	aFree(handle);
+	return true;
+}
+
+static struct thread_interface thread_s = {
+	thread_create,
+	thread_wait,
+};
+struct thread_interface *thread = &thread_s;
+
+/*==========================================
+ * Sessions: one per player, nothing is read or written
+ *------------------------------------------*/
+static bool session_is_valid(int fd)
+{
+	return fd > 0 && fd < sockt->fd_max && sockt->session[fd] != NULL;
+}
+
+static struct socket_interface sockt_s = {
+	.session_is_active = session_is_valid,
+	.session_is_valid = session_is_valid,
+};
+struct socket_interface *sockt = &sockt_s;
+
+int bench_session_new(void *session_data)
+{
+	static int fd_size = 0;
+	int fd = sockt->fd_max > 0 ? sockt->fd_max : 1; // fd 0 means "the area" to clif
+
+	if (fd >= fd_size) {
+		fd_size = max(fd_size * 2, 64);
+		RECREATE(sockt->session, struct socket_data *, fd_size);
+	}
+	CREATE(sockt->session[fd], struct socket_data, 1);
+	sockt->session[fd]->session_data = session_data;
+	sockt->fd_max = fd + 1;
+	return fd;
+}
+
+/*==========================================
+ * ERS: plain malloc, the plugins that need the real allocator bring their own
+ *------------------------------------------*/
+struct ers_malloc {
+	struct eri vtable; // Must be first
+	size_t size;
+};
+
+static void *ers_malloc_alloc(struct eri *self)
+{
+	return aCalloc(1, ((struct ers_malloc *)self)->size);
+}
+
+static void ers_malloc_free(struct eri *self, void *entry)
+{
+	aFree(entry);
+}
+
+static size_t ers_malloc_entry_size(struct eri *self)
+{
+	return ((struct ers_malloc *)self)->size;
+}
+
+static void ers_malloc_destroy(struct eri *self)
+{
+	aFree(self);
+}
+
+static void ers_malloc_chunk_size(struct eri *self, unsigned int new_size)
+{
+}
+
+__attribute__((weak)) ERS *ers_new(uint32 size, char *name, enum ERSOptions options)
+{
+	struct ers_malloc *ers;
+
+	CREATE(ers, struct ers_malloc, 1);
+	ers->vtable.alloc = ers_malloc_alloc;
+	ers->vtable.free = ers_malloc_free;
+	ers->vtable.entry_size = ers_malloc_entry_size;
+	ers->vtable.destroy = ers_malloc_destroy;
+	ers->vtable.chunk_size = ers_malloc_chunk_size;
+	ers->size = size;
+	return &ers->vtable;
+}
@@ -0,0 +1,505 @@
+//===== Plugin bench =========================================
+//= hpm.c
+//===== Description: =========================================
+//= Stand-in for the Hercules Plugin Manager and HPMHooking:
+//= plugin data stores, @commands and pre/post hooks.
+//===== Additional Comments: =================================
+//= Hooks run as HPMHooking runs them: every pre-hook, then the
+//= original and the post-hooks unless a pre-hook called
+//= hookStop(). Only the functions the plugins of this repo hook
+//= can be hooked, see hpm_hooks[].
+//============================================================
+#include "common/hercules.h"
+#include "common/HPMi.h"
+#include "common/memmgr.h"
+#include "common/showmsg.h"
+#include "common/strlib.h"
+#include "map/atcommand.h"
+#include "map/clif.h"
+#include "map/homunculus.h"
+#include "map/map.h"
+#include "map/mob.h"
+#include "map/path.h"
+#include "map/status.h"
+#include "plugins/HPMHooking.h"
+#include "server.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HPM_PLUGIN_ID 1 // Each bench binary loads a single plugin
+#define HPM_MAX_HOOKS 8 // Pre- or post-hooks per function
+#define HPM_MAX_COMMANDS 32
+
+/*==========================================
+ * Plugin data stores
+ *------------------------------------------*/
+struct hplugin_data_entry {
+	uint32 pluginID;
+	uint32 classid;
+	void *data;
+	bool autofree;
+};
+
+struct hplugin_data_store {
+	enum HPluginDataTypes type;
+	int count;
+	struct hplugin_data_entry *entries;
+};
+
+static void hpm_addToHPData(enum HPluginDataTypes type, uint32 pluginID, struct hplugin_data_store **storeptr, void *data, uint32 classid, bool autofree)
+{
+	struct hplugin_data_store *store;
+	int i;
+
+	if (*storeptr == NULL) {
+		CREATE(*storeptr, struct hplugin_data_store, 1);
+		(*storeptr)->type = type;
+	}
+	store = *storeptr;
+	if (store->type != type) {
+		ShowError("HPM->addToHPData: plugin %u tried to add data of type %d to a store of type %d.\n", pluginID, type, store->type);
+		return;
+	}
+	ARR_FIND(0, store->count, i, store->entries[i].pluginID == pluginID && store->entries[i].classid == classid);
+	if (i < store->count) {
+		ShowError("HPM->addToHPData: plugin %u overwriting its data for class %u.\n", pluginID, classid);
+		return;
+	}
+	RECREATE(store->entries, struct hplugin_data_entry, store->count + 1);
+	store->entries[store->count].pluginID = pluginID;
+	store->entries[store->count].classid = classid;
+	store->entries[store->count].data = data;
+	store->entries[store->count].autofree = autofree;
+	store->count++;
+}
+
+static void *hpm_getFromHPData(enum HPluginDataTypes type, uint32 pluginID, struct hplugin_data_store *store, uint32 classid)
+{
+	int i;
+
+	if (store == NULL)
+		return NULL;
+	ARR_FIND(0, store->count, i, store->entries[i].pluginID == pluginID && store->entries[i].classid == classid);
+	return i < store->count ? store->entries[i].data : NULL;
+}
+
+static void hpm_removeFromHPData(enum HPluginDataTypes type, uint32 pluginID, struct hplugin_data_store *store, uint32 classid)
+{
+	int i;
+
+	if (store == NULL)
+		return;
+	ARR_FIND(0, store->count, i, store->entries[i].pluginID == pluginID && store->entries[i].classid == classid);
+	if (i == store->count)
+		return;
+	if (store->entries[i].autofree)
+		aFree(store->entries[i].data);
+	memmove(&store->entries[i], &store->entries[i + 1], (store->count - i - 1) * sizeof(store->entries[0]));
+	store->count--;
+}
+
+// What the map-server does when the object owning the store is freed
+void bench_hpm_free_store(struct hplugin_data_store **storeptr)
+{
+	struct hplugin_data_store *store = *storeptr;
+	int i;
+
+	if (store == NULL)
+		return;
+	for (i = 0; i < store->count; i++) {
+		if (store->entries[i].autofree)
+			aFree(store->entries[i].data);
+	}
+	aFree(store->entries);
+	aFree(store);
+	*storeptr = NULL;
+}
+
+/*==========================================
+ * @commands
+ *------------------------------------------*/
+static struct AtCommandInfo hpm_commands[HPM_MAX_COMMANDS];
+static int hpm_command_count = 0;
+
+static bool hpm_addCommand(char *name, AtCommandFunc func, unsigned int pid)
+{
+	int i;
+
+	ARR_FIND(0, hpm_command_count, i, strcmpi(hpm_commands[i].command, name) == 0);
+	if (i < hpm_command_count) {
+		ShowError("HPM->addCommand: '%s' already exists, plugin %u can't add it.\n", name, pid);
+		return false;
+	}
+	if (hpm_command_count == HPM_MAX_COMMANDS) {
+		ShowError("HPM->addCommand: too many commands, '%s' was not added.\n", name);
+		return false;
+	}
+	safestrncpy(hpm_commands[hpm_command_count].command, name, sizeof(hpm_commands[0].command));
+	hpm_commands[hpm_command_count].func = func;
+	hpm_command_count++;
+	return true;
+}
+
+// atcommand->exec of the map-server, without groups and logging
+bool bench_atcommand_exec(const int fd, struct map_session_data *sd, const char *message, bool player_invoked)
+{
+	char command[50], output[CHAT_SIZE_MAX];
+	const char *params;
+	size_t len;
+	int i;
+
+	if (message == NULL || message[0] != atcommand->at_symbol)
+		return false;
+
+	len = strcspn(message + 1, " \t");
+	if (len == 0 || len >= sizeof(command))
+		return false;
+	memcpy(command, message + 1, len);
+	command[len] = '\0';
+	for (params = message + 1 + len; ISSPACE(*params); params++)
+		;
+
+	ARR_FIND(0, hpm_command_count, i, strcmpi(hpm_commands[i].command, command) == 0);
+	if (i == hpm_command_count) {
+		snprintf(output, sizeof(output), msg_fd(fd, 153), message); // %s is Unknown Command.
+		clif->message(fd, output);
+		return true;
+	}
+	snprintf(output, sizeof(output), "%c%s", atcommand->at_symbol, command);
+	if (!hpm_commands[i].func(fd, sd, output, params, &hpm_commands[i])) {
+		snprintf(output, sizeof(output), msg_fd(fd, 154), command); // %s failed.
+		clif->message(fd, output);
+	}
+	return true;
+}
+
+/*==========================================
+ * Hooks
+ *------------------------------------------*/
+enum hpm_hook_id {
+	HP_atcommand_exec,
+	HP_homun_reload,
+	HP_homun_levelup,
+	HP_homun_evolve,
+	HP_homun_delete,
+	HP_status_change_start,
+	HP_status_change_end_,
+	HP_map_setcell,
+	HP_map_setgatcell,
+	HP_map_addblock,
+	HP_map_delblock,
+	HP_map_deliddb,
+	HP_mob_ai_hard,
+	HP_mob_spawn,
+	HP_mob_reload,
+	HP_mob_damage,
+	HP_mob_heal,
+	HP_path_search,
+	HP_MAX,
+};
+
+struct hpm_hook {
+	const char *target; // "interface->function", as addHookPre/addHookPost spell it
+	void **slot; // The interface member
+	void *trampoline; // Put in the slot once the function is hooked
+	void *original;
+	void *pre[HPM_MAX_HOOKS];
+	int pre_count;
+	void *post[HPM_MAX_HOOKS];
+	int post_count;
+};
+
+static struct hpm_hook hpm_hooks[HP_MAX];
+static bool hpm_force_return = false;
+
+// Every pre-hook runs; a hookStop() from any of them skips the original and the post-hooks.
+#define HPM_PRE(name, ...) do { \
+	int hIndex; \
+	for (hIndex = 0; hIndex < hpm_hooks[HP_ ## name].pre_count; hIndex++) \
+		retVal___ = ((HPMHOOK_pre_ ## name)hpm_hooks[HP_ ## name].pre[hIndex])(__VA_ARGS__); \
+	if (hpm_force_return) { \
+		hpm_force_return = false; \
+		return retVal___; \
+	} \
+} while (0)
+#define HPM_PRE_VOID(name, ...) do { \
+	int hIndex; \
+	for (hIndex = 0; hIndex < hpm_hooks[HP_ ## name].pre_count; hIndex++) \
+		((HPMHOOK_pre_ ## name)hpm_hooks[HP_ ## name].pre[hIndex])(__VA_ARGS__); \
+	if (hpm_force_return) { \
+		hpm_force_return = false; \
+		return; \
+	} \
+} while (0)
+#define HPM_POST(name, ...) do { \
+	int hIndex; \
+	for (hIndex = 0; hIndex < hpm_hooks[HP_ ## name].post_count; hIndex++) \
+		retVal___ = ((HPMHOOK_post_ ## name)hpm_hooks[HP_ ## name].post[hIndex])(retVal___, __VA_ARGS__); \
+} while (0)
+#define HPM_POST_VOID(name, ...) do { \
+	int hIndex; \
+	for (hIndex = 0; hIndex < hpm_hooks[HP_ ## name].post_count; hIndex++) \
+		((HPMHOOK_post_ ## name)hpm_hooks[HP_ ## name].post[hIndex])(__VA_ARGS__); \
+} while (0)
+#define HPM_SOURCE(name, type) ((type)hpm_hooks[HP_ ## name].original)
+
+static bool HP_atcommand_exec_(const int fd, struct map_session_data *sd, const char *message, bool player_invoked)
+{
+	bool retVal___ = false;
+
+	HPM_PRE(atcommand_exec, &fd, &sd, &message, &player_invoked);
+	retVal___ = HPM_SOURCE(atcommand_exec, bool (*)(const int, struct map_session_data *, const char *, bool))(fd, sd, message, player_invoked);
+	HPM_POST(atcommand_exec, fd, sd, message, player_invoked);
+	return retVal___;
+}
+
+static void HP_homun_reload_(void)
+{
+	int hIndex;
+
+	for (hIndex = 0; hIndex < hpm_hooks[HP_homun_reload].pre_count; hIndex++)
+		((HPMHOOK_pre_homun_reload)hpm_hooks[HP_homun_reload].pre[hIndex])();
+	if (hpm_force_return) {
+		hpm_force_return = false;
+		return;
+	}
+	HPM_SOURCE(homun_reload, void (*)(void))();
+	for (hIndex = 0; hIndex < hpm_hooks[HP_homun_reload].post_count; hIndex++)
+		((HPMHOOK_post_homun_reload)hpm_hooks[HP_homun_reload].post[hIndex])();
+}
+
+static bool HP_homun_levelup_(struct homun_data *hd)
+{
+	bool retVal___ = false;
+
+	HPM_PRE(homun_levelup, &hd);
+	retVal___ = HPM_SOURCE(homun_levelup, bool (*)(struct homun_data *))(hd);
+	HPM_POST(homun_levelup, hd);
+	return retVal___;
+}
+
+static bool HP_homun_evolve_(struct homun_data *hd)
+{
+	bool retVal___ = false;
+
+	HPM_PRE(homun_evolve, &hd);
+	retVal___ = HPM_SOURCE(homun_evolve, bool (*)(struct homun_data *))(hd);
+	HPM_POST(homun_evolve, hd);
+	return retVal___;
+}
+
+static bool HP_homun_delete_(struct homun_data *hd, int emote)
+{
+	bool retVal___ = false;
+
+	HPM_PRE(homun_delete, &hd, &emote);
+	retVal___ = HPM_SOURCE(homun_delete, bool (*)(struct homun_data *, int))(hd, emote);
+	HPM_POST(homun_delete, hd, emote);
+	return retVal___;
+}
+
+static int HP_status_change_start_(struct block_list *src, struct block_list *bl, enum sc_type type, int rate, int val1, int val2, int val3, int val4, int total_tick, int flag, int skill_id)
+{
+	int retVal___ = 0;
+
+	HPM_PRE(status_change_start, &src, &bl, &type, &rate, &val1, &val2, &val3, &val4, &total_tick, &flag, &skill_id);
+	retVal___ = HPM_SOURCE(status_change_start, int (*)(struct block_list *, struct block_list *, enum sc_type, int, int, int, int, int, int, int, int))(src, bl, type, rate, val1, val2, val3, val4, total_tick, flag, skill_id);
+	HPM_POST(status_change_start, src, bl, type, rate, val1, val2, val3, val4, total_tick, flag, skill_id);
+	return retVal___;
+}
+
+static int HP_status_change_end__(struct block_list *bl, enum sc_type type, int tid, const char *file, int line)
+{
+	int retVal___ = 0;
+
+	HPM_PRE(status_change_end_, &bl, &type, &tid, &file, &line);
+	retVal___ = HPM_SOURCE(status_change_end_, int (*)(struct block_list *, enum sc_type, int, const char *, int))(bl, type, tid, file, line);
+	HPM_POST(status_change_end_, bl, type, tid, file, line);
+	return retVal___;
+}
+
+static void HP_map_setcell_(int16 m, int16 x, int16 y, cell_t cell, bool flag)
+{
+	HPM_PRE_VOID(map_setcell, &m, &x, &y, &cell, &flag);
+	HPM_SOURCE(map_setcell, void (*)(int16, int16, int16, cell_t, bool))(m, x, y, cell, flag);
+	HPM_POST_VOID(map_setcell, m, x, y, cell, flag);
+}
+
+static void HP_map_setgatcell_(int16 m, int16 x, int16 y, int gat)
+{
+	HPM_PRE_VOID(map_setgatcell, &m, &x, &y, &gat);
+	HPM_SOURCE(map_setgatcell, void (*)(int16, int16, int16, int))(m, x, y, gat);
+	HPM_POST_VOID(map_setgatcell, m, x, y, gat);
+}
+
+static int HP_map_addblock_(struct block_list *bl)
+{
+	int retVal___ = 0;
+
+	HPM_PRE(map_addblock, &bl);
+	retVal___ = HPM_SOURCE(map_addblock, int (*)(struct block_list *))(bl);
+	HPM_POST(map_addblock, bl);
+	return retVal___;
+}
+
+static int HP_map_delblock_(struct block_list *bl)
+{
+	int retVal___ = 0;
+
+	HPM_PRE(map_delblock, &bl);
+	retVal___ = HPM_SOURCE(map_delblock, int (*)(struct block_list *))(bl);
+	HPM_POST(map_delblock, bl);
+	return retVal___;
+}
+
+static void HP_map_deliddb_(struct block_list *bl)
+{
+	HPM_PRE_VOID(map_deliddb, &bl);
+	HPM_SOURCE(map_deliddb, void (*)(struct block_list *))(bl);
+	HPM_POST_VOID(map_deliddb, bl);
+}
+
+static int HP_mob_ai_hard_(int tid, int64 tick, int id, intptr_t data)
+{
+	int retVal___ = 0;
+
+	HPM_PRE(mob_ai_hard, &tid, &tick, &id, &data);
+	retVal___ = HPM_SOURCE(mob_ai_hard, int (*)(int, int64, int, intptr_t))(tid, tick, id, data);
+	HPM_POST(mob_ai_hard, tid, tick, id, data);
+	return retVal___;
+}
+
+static int HP_mob_spawn_(struct mob_data *md)
+{
+	int retVal___ = 0;
+
+	HPM_PRE(mob_spawn, &md);
+	retVal___ = HPM_SOURCE(mob_spawn, int (*)(struct mob_data *))(md);
+	HPM_POST(mob_spawn, md);
+	return retVal___;
+}
+
+static void HP_mob_reload_(void)
+{
+	int hIndex;
+
+	for (hIndex = 0; hIndex < hpm_hooks[HP_mob_reload].pre_count; hIndex++)
+		((HPMHOOK_pre_mob_reload)hpm_hooks[HP_mob_reload].pre[hIndex])();
+	if (hpm_force_return) {
+		hpm_force_return = false;
+		return;
+	}
+	HPM_SOURCE(mob_reload, void (*)(void))();
+	for (hIndex = 0; hIndex < hpm_hooks[HP_mob_reload].post_count; hIndex++)
+		((HPMHOOK_post_mob_reload)hpm_hooks[HP_mob_reload].post[hIndex])();
+}
+
+static void HP_mob_damage_(struct mob_data *md, struct block_list *src, int damage)
+{
+	HPM_PRE_VOID(mob_damage, &md, &src, &damage);
+	HPM_SOURCE(mob_damage, void (*)(struct mob_data *, struct block_list *, int))(md, src, damage);
+	HPM_POST_VOID(mob_damage, md, src, damage);
+}
+
+static void HP_mob_heal_(struct mob_data *md, unsigned int heal)
+{
+	HPM_PRE_VOID(mob_heal, &md, &heal);
+	HPM_SOURCE(mob_heal, void (*)(struct mob_data *, unsigned int))(md, heal);
+	HPM_POST_VOID(mob_heal, md, heal);
+}
+
+static bool HP_path_search_(struct walkpath_data *wpd, struct block_list *bl, int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int flag, cell_chk cell)
+{
+	bool retVal___ = false;
+
+	HPM_PRE(path_search, &wpd, &bl, &m, &x0, &y0, &x1, &y1, &flag, &cell);
+	retVal___ = HPM_SOURCE(path_search, bool (*)(struct walkpath_data *, struct block_list *, int16, int16, int16, int16, int16, int, cell_chk))(wpd, bl, m, x0, y0, x1, y1, flag, cell);
+	HPM_POST(path_search, wpd, bl, m, x0, y0, x1, y1, flag, cell);
+	return retVal___;
+}
+
+// The interfaces are only complete once the stand-in server is set up, so the table is filled in here
+static void hpm_hooks_init(void)
+{
+#define HPM_HOOKABLE(id, target_, member) ( \
+	hpm_hooks[id].target = (target_), \
+	hpm_hooks[id].slot = (void **)&(member), \
+	hpm_hooks[id].trampoline = (void *)id ## _ \
+	)
+	HPM_HOOKABLE(HP_atcommand_exec, "atcommand->exec", atcommand->exec);
+	HPM_HOOKABLE(HP_homun_reload, "homun->reload", homun->reload);
+	HPM_HOOKABLE(HP_homun_levelup, "homun->levelup", homun->levelup);
+	HPM_HOOKABLE(HP_homun_evolve, "homun->evolve", homun->evolve);
+	HPM_HOOKABLE(HP_homun_delete, "homun->delete", homun->delete);
+	HPM_HOOKABLE(HP_status_change_start, "status->change_start", status->change_start);
+	HPM_HOOKABLE(HP_status_change_end_, "status->change_end_", status->change_end_);
+	HPM_HOOKABLE(HP_map_setcell, "map->setcell", map->setcell);
+	HPM_HOOKABLE(HP_map_setgatcell, "map->setgatcell", map->setgatcell);
+	HPM_HOOKABLE(HP_map_addblock, "map->addblock", map->addblock);
+	HPM_HOOKABLE(HP_map_delblock, "map->delblock", map->delblock);
+	HPM_HOOKABLE(HP_map_deliddb, "map->deliddb", map->deliddb);
+	HPM_HOOKABLE(HP_mob_ai_hard, "mob->ai_hard", mob->ai_hard);
+	HPM_HOOKABLE(HP_mob_spawn, "mob->spawn", mob->spawn);
+	HPM_HOOKABLE(HP_mob_reload, "mob->reload", mob->reload);
+	HPM_HOOKABLE(HP_mob_damage, "mob->damage", mob->damage);
+	HPM_HOOKABLE(HP_mob_heal, "mob->heal", mob->heal);
+	HPM_HOOKABLE(HP_path_search, "path->search", path->search);
+#undef HPM_HOOKABLE
+}
+
+// The trampoline takes the slot on the first hook, as HPMHooking takes every slot when it loads
+static int hpm_AddHook(enum HPluginHookType type, const char *target, void *hook, unsigned int pID)
+{
+	struct hpm_hook *h;
+	int i;
+
+	ARR_FIND(0, HP_MAX, i, strcmp(hpm_hooks[i].target, target) == 0);
+	if (i == HP_MAX) {
+		ShowError("HPM->AddHook: '%s' can't be hooked off-server, add it to bench/hpm.c.\n", target);
+		exit(EXIT_FAILURE);
+	}
+	h = &hpm_hooks[i];
+	if (h->original == NULL) {
+		h->original = *h->slot;
+		*h->slot = h->trampoline;
+	}
+	if (type == HOOK_TYPE_PRE) {
+		if (h->pre_count == HPM_MAX_HOOKS)
+			return false;
+		h->pre[h->pre_count++] = hook;
+	} else {
+		if (h->post_count == HPM_MAX_HOOKS)
+			return false;
+		h->post[h->post_count++] = hook;
+	}
+	return true;
+}
+
+static void hpm_HookStop(const char *func, unsigned int pID)
+{
+	hpm_force_return = true;
+}
+
+static bool hpm_HookStopped(void)
+{
+	return hpm_force_return;
+}
+
+static struct HPMi_interface HPMi_s = {
+	.pid = HPM_PLUGIN_ID,
+	.addCommand = hpm_addCommand,
+	.addToHPData = hpm_addToHPData,
+	.getFromHPData = hpm_getFromHPData,
+	.removeFromHPData = hpm_removeFromHPData,
+	.AddHook = hpm_AddHook,
+	.HookStop = hpm_HookStop,
+	.HookStopped = hpm_HookStopped,
+};
+struct HPMi_interface *HPMi = &HPMi_s;
+
+void bench_hpm_init(void)
+{
+	hpm_hooks_init();
+}
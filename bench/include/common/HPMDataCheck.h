@@ -0,0 +1,6 @@
+// Stand-in for Hercules' common/HPMDataCheck.h, see bench/README.md.
+// Nothing from it is used off-server.
+#ifndef COMMON_HPMDATACHECK_H
+#define COMMON_HPMDATACHECK_H
+
+#endif /* COMMON_HPMDATACHECK_H */
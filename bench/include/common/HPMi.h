@@ -0,0 +1,78 @@
+// Stand-in for Hercules' common/HPMi.h, see bench/README.md.
+#ifndef COMMON_HPMI_H
+#define COMMON_HPMI_H
+
+#include "common/hercules.h"
+#include "common/showmsg.h"
+
+struct AtCommandInfo;
+struct map_session_data;
+struct hplugin_data_store;
+
+#define HPM_VERSION "1.2"
+#define HPM_ADDCONF_LENGTH 40
+
+enum hp_server_types {
+	SERVER_TYPE_UNKNOWN = 0x0,
+	SERVER_TYPE_LOGIN = 0x1,
+	SERVER_TYPE_CHAR = 0x2,
+	SERVER_TYPE_MAP = 0x4,
+	SERVER_TYPE_ALL = SERVER_TYPE_LOGIN|SERVER_TYPE_CHAR|SERVER_TYPE_MAP,
+};
+
+struct hplugin_info {
+	char *name;
+	enum hp_server_types type;
+	char *version;
+	char *req_version;
+};
+
+enum HPluginHookType {
+	HOOK_TYPE_PRE,
+	HOOK_TYPE_POST,
+};
+
+enum HPluginDataTypes {
+	HPDT_UNKNOWN,
+	HPDT_MSD,
+	HPDT_NPCD,
+	HPDT_MAP,
+	HPDT_INSTANCE,
+	HPDT_GUILD,
+	HPDT_PARTY,
+	HPDT_MOBDB,
+	HPDT_MOBDATA,
+	HPDT_ITEMDATA,
+	HPDT_BGDATA,
+	HPDT_AUTOTRADE_VEND,
+	HPDT_SESSION,
+};
+
+typedef bool (*AtCommandFunc)(const int fd, struct map_session_data *sd, const char *command, const char *message, struct AtCommandInfo *info);
+
+struct HPMi_interface {
+	unsigned int pid;
+	bool (*addCommand)(char *name, AtCommandFunc func, unsigned int pid);
+	void (*addToHPData)(enum HPluginDataTypes type, uint32 pluginID, struct hplugin_data_store **store, void *data, uint32 classid, bool autofree);
+	void *(*getFromHPData)(enum HPluginDataTypes type, uint32 pluginID, struct hplugin_data_store *store, uint32 classid);
+	void (*removeFromHPData)(enum HPluginDataTypes type, uint32 pluginID, struct hplugin_data_store *store, uint32 classid);
+	int (*AddHook)(enum HPluginHookType type, const char *target, void *hook, unsigned int pID);
+	void (*HookStop)(const char *func, unsigned int pID);
+	bool (*HookStopped)(void);
+};
+
+extern struct HPMi_interface *HPMi;
+
+#define addAtcommand(cname, funcname) HPMi->addCommand((cname), atcommand_ ## funcname, HPMi->pid)
+
+#define addToMSD(ptr, data, classid, autofree) HPMi->addToHPData(HPDT_MSD, HPMi->pid, &(ptr)->hdata, (data), (classid), (autofree))
+#define getFromMSD(ptr, classid) HPMi->getFromHPData(HPDT_MSD, HPMi->pid, (ptr)->hdata, (classid))
+#define removeFromMSD(ptr, classid) HPMi->removeFromHPData(HPDT_MSD, HPMi->pid, (ptr)->hdata, (classid))
+#define addToMOBDATA(ptr, data, classid, autofree) HPMi->addToHPData(HPDT_MOBDATA, HPMi->pid, &(ptr)->hdata, (data), (classid), (autofree))
+#define getFromMOBDATA(ptr, classid) HPMi->getFromHPData(HPDT_MOBDATA, HPMi->pid, (ptr)->hdata, (classid))
+#define removeFromMOBDATA(ptr, classid) HPMi->removeFromHPData(HPDT_MOBDATA, HPMi->pid, (ptr)->hdata, (classid))
+#define addToSession(ptr, data, classid, autofree) HPMi->addToHPData(HPDT_SESSION, HPMi->pid, &(ptr)->hdata, (data), (classid), (autofree))
+#define getFromSession(ptr, classid) HPMi->getFromHPData(HPDT_SESSION, HPMi->pid, (ptr)->hdata, (classid))
+#define removeFromSession(ptr, classid) HPMi->removeFromHPData(HPDT_SESSION, HPMi->pid, (ptr)->hdata, (classid))
+
+#endif /* COMMON_HPMI_H */
@@ -0,0 +1,14 @@
+// Stand-in for Hercules' common/atomic.h, see bench/README.md.
+#ifndef COMMON_ATOMIC_H
+#define COMMON_ATOMIC_H
+
+#include "common/cbasetypes.h"
+
+#define InterlockedIncrement(p) __sync_add_and_fetch((p), 1)
+#define InterlockedDecrement(p) __sync_sub_and_fetch((p), 1)
+#define InterlockedExchangeAdd(p, v) __sync_fetch_and_add((p), (v))
+#define InterlockedExchangeAdd64(p, v) __sync_fetch_and_add((p), (v))
+#define InterlockedCompareExchange(p, v, c) __sync_val_compare_and_swap((p), (c), (v))
+#define InterlockedExchange(p, v) __sync_lock_test_and_set((p), (v))
+
+#endif /* COMMON_ATOMIC_H */
@@ -0,0 +1,53 @@
+// Stand-in for Hercules' common/cbasetypes.h, see bench/README.md.
+#ifndef COMMON_CBASETYPES_H
+#define COMMON_CBASETYPES_H
+
+#include <ctype.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <strings.h>
+
+typedef int8_t int8;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef intptr_t intptr;
+typedef uintptr_t uintptr;
+
+#define strcmpi strcasecmp
+#define strncmpi strncasecmp
+
+#ifndef max
+#define max(a, b) (((a) >= (b)) ? (a) : (b))
+#endif
+#ifndef min
+#define min(a, b) (((a) <= (b)) ? (a) : (b))
+#endif
+#define cap_value(a, min, max) (((a) >= (max)) ? (max) : ((a) <= (min)) ? (min) : (a))
+#define swap(a, b) do { if ((a) != (b)) { (a) ^= (b); (b) ^= (a); (a) ^= (b); } } while (0)
+
+#define ARRAYLENGTH(A) (sizeof(A) / sizeof((A)[0]))
+#define ARR_FIND(__start, __end, __var, __cmp) \
+	do { \
+		for ((__var) = (__start); (__var) < (__end); ++(__var)) \
+			if (__cmp) \
+				break; \
+	} while (0)
+
+#define ISALNUM(c) (isalnum((unsigned char)(c)))
+#define ISALPHA(c) (isalpha((unsigned char)(c)))
+#define ISDIGIT(c) (isdigit((unsigned char)(c)))
+#define ISSPACE(c) (isspace((unsigned char)(c)))
+#define TOLOWER(c) (tolower((unsigned char)(c)))
+#define TOUPPER(c) (toupper((unsigned char)(c)))
+
+#define UNUSED __attribute__((unused))
+
+#endif /* COMMON_CBASETYPES_H */
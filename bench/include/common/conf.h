@@ -0,0 +1,6 @@
+// Stand-in for Hercules' common/conf.h, see bench/README.md.
+// Nothing from it is used off-server.
+#ifndef COMMON_CONF_H
+#define COMMON_CONF_H
+
+#endif /* COMMON_CONF_H */
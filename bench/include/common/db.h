@@ -0,0 +1,112 @@
+// Stand-in for Hercules' common/db.h, see bench/README.md.
+// Same interface, backed by a plain chained hash table in bench/core.c.
+#ifndef COMMON_DB_H
+#define COMMON_DB_H
+
+#include "common/cbasetypes.h"
+
+#include <stdarg.h>
+
+enum DBOptions {
+	DB_OPT_BASE = 0x00,
+	DB_OPT_DUP_KEY = 0x01,
+	DB_OPT_RELEASE_KEY = 0x02,
+	DB_OPT_RELEASE_DATA = 0x04,
+	DB_OPT_RELEASE_BOTH = DB_OPT_RELEASE_KEY|DB_OPT_RELEASE_DATA,
+	DB_OPT_ALLOW_NULL_KEY = 0x08,
+	DB_OPT_ALLOW_NULL_DATA = 0x10,
+};
+
+enum DBType {
+	DB_INT,
+	DB_UINT,
+	DB_STRING,
+	DB_ISTRING,
+	DB_INT64,
+	DB_UINT64,
+};
+
+enum DBDataType {
+	DB_DATA_INT,
+	DB_DATA_UINT,
+	DB_DATA_PTR,
+};
+
+union DBKey {
+	int i;
+	unsigned int ui;
+	const char *str;
+	char *mutstr;
+	int64 i64;
+	uint64 ui64;
+};
+
+struct DBData {
+	enum DBDataType type;
+	union {
+		int i;
+		unsigned int ui;
+		void *ptr;
+	} u;
+};
+
+typedef int (*DBApply)(union DBKey key, struct DBData *data, va_list args);
+
+struct DBIterator {
+	struct DBData *(*first)(struct DBIterator *self, union DBKey *out_key);
+	struct DBData *(*next)(struct DBIterator *self, union DBKey *out_key);
+	bool (*exists)(struct DBIterator *self);
+	void (*destroy)(struct DBIterator *self);
+};
+
+struct DBMap {
+	struct DBIterator *(*iterator)(struct DBMap *self);
+	bool (*exists)(struct DBMap *self, union DBKey key);
+	struct DBData *(*get)(struct DBMap *self, union DBKey key);
+	int (*put)(struct DBMap *self, union DBKey key, struct DBData data, struct DBData *out_data);
+	int (*remove)(struct DBMap *self, union DBKey key, struct DBData *out_data);
+	int (*clear)(struct DBMap *self, DBApply func, ...);
+	int (*destroy)(struct DBMap *self, DBApply func, ...);
+	unsigned int (*size)(struct DBMap *self);
+};
+
+struct db_interface {
+	struct DBMap *(*alloc)(const char *file, const char *func, int line, enum DBType type, enum DBOptions options, unsigned short maxlen);
+	union DBKey (*i2key)(int key);
+	union DBKey (*ui2key)(unsigned int key);
+	union DBKey (*i642key)(int64 key);
+	union DBKey (*ui642key)(uint64 key);
+	struct DBData (*i2data)(int data);
+	struct DBData (*ui2data)(unsigned int data);
+	struct DBData (*ptr2data)(void *data);
+	int (*data2i)(struct DBData *data);
+	unsigned int (*data2ui)(struct DBData *data);
+	void *(*data2ptr)(struct DBData *data);
+};
+
+extern struct db_interface *DB;
+
+#define idb_alloc(opt) DB->alloc(__FILE__, __func__, __LINE__, DB_INT, (opt), sizeof(int))
+#define uidb_alloc(opt) DB->alloc(__FILE__, __func__, __LINE__, DB_UINT, (opt), sizeof(unsigned int))
+#define i64db_alloc(opt) DB->alloc(__FILE__, __func__, __LINE__, DB_INT64, (opt), sizeof(int64))
+
+#define idb_exists(db, k) ((db)->exists((db), DB->i2key(k)))
+#define idb_get(db, k) (DB->data2ptr((db)->get((db), DB->i2key(k))))
+#define idb_put(db, k, d) ((db)->put((db), DB->i2key(k), DB->ptr2data(d), NULL))
+#define idb_remove(db, k) ((db)->remove((db), DB->i2key(k), NULL))
+#define idb_iget(db, k) (DB->data2i((db)->get((db), DB->i2key(k))))
+#define idb_iput(db, k, d) ((db)->put((db), DB->i2key(k), DB->i2data(d), NULL))
+#define i64db_get(db, k) (DB->data2ptr((db)->get((db), DB->i642key(k))))
+#define i64db_put(db, k, d) ((db)->put((db), DB->i642key(k), DB->ptr2data(d), NULL))
+#define i64db_remove(db, k) ((db)->remove((db), DB->i642key(k), NULL))
+
+#define db_clear(db) ((db)->clear((db), NULL))
+#define db_destroy(db) ((db)->destroy((db), NULL))
+#define db_size(db) ((db)->size(db))
+#define db_iterator(db) ((db)->iterator(db))
+#define dbi_first(dbi) (DB->data2ptr((dbi)->first((dbi), NULL)))
+#define dbi_next(dbi) (DB->data2ptr((dbi)->next((dbi), NULL)))
+#define dbi_exists(dbi) ((dbi)->exists(dbi))
+#define dbi_destroy(dbi) ((dbi)->destroy(dbi))
+
+#endif /* COMMON_DB_H */
@@ -0,0 +1,38 @@
+// Stand-in for Hercules' common/ers.h, see bench/README.md.
+#ifndef COMMON_ERS_H
+#define COMMON_ERS_H
+
+#include "common/cbasetypes.h"
+
+#ifndef ERS_ALIGNED
+#define ERS_ALIGNED 1
+#endif
+
+enum ERSOptions {
+	ERS_OPT_NONE = 0x00,
+	ERS_OPT_CLEAR = 0x01, // Silently free the entries left at destroy time
+	ERS_OPT_WAIT = 0x02,
+	ERS_OPT_FREE_NAME = 0x04,
+	ERS_OPT_CLEAN = 0x08, // Zero the entries on free
+	ERS_OPT_FLEX_CHUNK = 0x10,
+
+	ERS_CACHE_OPTIONS = ERS_OPT_CLEAN|ERS_OPT_FLEX_CHUNK,
+};
+
+typedef struct eri {
+	void *(*alloc)(struct eri *self);
+	void (*free)(struct eri *self, void *entry);
+	size_t (*entry_size)(struct eri *self);
+	void (*destroy)(struct eri *self);
+	void (*chunk_size)(struct eri *self, unsigned int new_size);
+} ERS;
+
+#define ers_alloc(obj, type) ((type *)(obj)->alloc(obj))
+#define ers_free(obj, entry) ((obj)->free((obj), (entry)))
+#define ers_entry_size(obj) ((obj)->entry_size(obj))
+#define ers_destroy(obj) ((obj)->destroy(obj))
+#define ers_chunk_size(obj, size) ((obj)->chunk_size((obj), (size)))
+
+ERS *ers_new(uint32 size, char *name, enum ERSOptions options);
+
+#endif /* COMMON_ERS_H */
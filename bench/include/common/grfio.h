@@ -0,0 +1,6 @@
+// Stand-in for Hercules' common/grfio.h, see bench/README.md.
+// Nothing from it is used off-server.
+#ifndef COMMON_GRFIO_H
+#define COMMON_GRFIO_H
+
+#endif /* COMMON_GRFIO_H */
@@ -0,0 +1,10 @@
+// Stand-in for Hercules' common/hercules.h, see bench/README.md.
+#ifndef COMMON_HERCULES_H
+#define COMMON_HERCULES_H
+
+#include "config/core.h"
+#include "common/cbasetypes.h"
+
+#define HPExport
+
+#endif /* COMMON_HERCULES_H */
@@ -0,0 +1,6 @@
+// Stand-in for Hercules' common/mapindex.h, see bench/README.md.
+// Nothing from it is used off-server.
+#ifndef COMMON_MAPINDEX_H
+#define COMMON_MAPINDEX_H
+
+#endif /* COMMON_MAPINDEX_H */
@@ -0,0 +1,17 @@
+// Stand-in for Hercules' common/memmgr.h, see bench/README.md.
+#ifndef COMMON_MEMMGR_H
+#define COMMON_MEMMGR_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#define aMalloc(n) malloc(n)
+#define aCalloc(m, n) calloc((m), (n))
+#define aRealloc(p, n) realloc((p), (n))
+#define aStrdup(p) strdup(p)
+#define aFree(p) free(p)
+
+#define CREATE(result, type, number) ((result) = (type *)aCalloc((number), sizeof(type)))
+#define RECREATE(result, type, number) ((result) = (type *)aRealloc((result), sizeof(type) * (number)))
+
+#endif /* COMMON_MEMMGR_H */
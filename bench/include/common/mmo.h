@@ -0,0 +1,125 @@
+// Stand-in for Hercules' common/mmo.h, see bench/README.md.
+#ifndef COMMON_MMO_H
+#define COMMON_MMO_H
+
+#include "config/core.h"
+#include "common/cbasetypes.h"
+
+#include <time.h>
+
+#ifndef PACKETVER
+#define PACKETVER 20190530
+#endif
+#define PACKETVER_MAIN_NUM PACKETVER
+#define PACKETVER_RE_NUM 0
+#define PACKETVER_ZERO_NUM 0
+
+#define NEW_CARTS
+
+#define NAME_LENGTH (23 + 1)
+#define MAP_NAME_LENGTH (11 + 1)
+#define MAP_NAME_LENGTH_EXT (MAP_NAME_LENGTH + 4)
+#define CHAT_SIZE_MAX (255 + 1)
+#define MAX_SLOTS 4
+#define MAX_ITEM_OPTIONS 5
+#define MAX_INVENTORY 100
+#define MAX_SKILL_DB 1314
+#define MAX_HOM_SKILL_TREE 8
+#define MAX_PC_BONUS 10
+#define MAX_PC_FEELHATE 3
+#define MAX_GUARDIANS 8
+#define MAX_MVP_DROP 3
+#define MAX_MOB_DROP 10
+
+enum item_types {
+	IT_HEALING = 0,
+	IT_UNKNOWN,
+	IT_USABLE,
+	IT_ETC,
+	IT_WEAPON,
+	IT_ARMOR,
+	IT_CARD,
+	IT_PETEGG,
+	IT_PETARMOR,
+	IT_UNKNOWN2,
+	IT_AMMO,
+	IT_DELAYCONSUME,
+	IT_CASH = 18,
+	IT_MAX,
+};
+
+struct item_option {
+	int16 index;
+	int16 value;
+	uint8 param;
+};
+
+struct item {
+	int id;
+	int nameid;
+	short amount;
+	unsigned int equip;
+	char identify;
+	char refine;
+	char attribute;
+	int card[MAX_SLOTS];
+	unsigned int expire_time;
+	char favorite;
+	unsigned char bound;
+	uint64 unique_id;
+	struct item_option option[MAX_ITEM_OPTIONS];
+};
+
+struct s_homunculus {
+	char name[NAME_LENGTH];
+	int hom_id;
+	int char_id;
+	int class_;
+	int prev_class;
+	int hp, max_hp, sp, max_sp;
+	unsigned int intimacy;
+	short hunger;
+	short level;
+	uint64 exp;
+	short rename_flag;
+	short vaporize;
+	int str;
+	int agi;
+	int vit;
+	int int_;
+	int dex;
+	int luk;
+	int str_value, agi_value, vit_value, int_value, dex_value, luk_value;
+	int8 spiritball;
+	int autofeed;
+};
+
+struct mmo_charstatus {
+	int char_id;
+	int account_id;
+	int partner_id;
+	int father;
+	int mother;
+	int child;
+
+	uint64 base_exp, job_exp;
+	int zeny;
+	int class;
+	int status_point, skill_point;
+	int hp, max_hp, sp, max_sp;
+	unsigned int option;
+	short manner;
+	unsigned char karma;
+	short hair, hair_color, clothes_color;
+	int body;
+	int party_id, guild_id, clan_id, pet_id, hom_id, mer_id, ele_id;
+	int fame;
+	int base_level, job_level;
+	short str, agi, vit, int_, dex, luk;
+	unsigned char slot, sex;
+	char name[NAME_LENGTH];
+	int mod_exp, mod_drop, mod_death;
+	unsigned char font;
+};
+
+#endif /* COMMON_MMO_H */
@@ -0,0 +1,14 @@
+// Stand-in for Hercules' common/nullpo.h, see bench/README.md.
+#ifndef COMMON_NULLPO_H
+#define COMMON_NULLPO_H
+
+#include "common/showmsg.h"
+
+#define nullpo_ret(t) do { if ((t) == NULL) { ShowError("nullpo: %s:%d\n", __FILE__, __LINE__); return 0; } } while (0)
+#define nullpo_retv(t) do { if ((t) == NULL) { ShowError("nullpo: %s:%d\n", __FILE__, __LINE__); return; } } while (0)
+#define nullpo_retr(ret, t) do { if ((t) == NULL) { ShowError("nullpo: %s:%d\n", __FILE__, __LINE__); return (ret); } } while (0)
+#define Assert_ret(t) do { if (!(t)) { ShowError("Assertion failed: %s:%d\n", __FILE__, __LINE__); return 0; } } while (0)
+#define Assert_retv(t) do { if (!(t)) { ShowError("Assertion failed: %s:%d\n", __FILE__, __LINE__); return; } } while (0)
+#define Assert_retr(ret, t) do { if (!(t)) { ShowError("Assertion failed: %s:%d\n", __FILE__, __LINE__); return (ret); } } while (0)
+
+#endif /* COMMON_NULLPO_H */
@@ -0,0 +1,7 @@
+// Stand-in for Hercules' common/packets.h, see bench/README.md.
+#ifndef COMMON_PACKETS_H
+#define COMMON_PACKETS_H
+
+#include "common/mmo.h"
+
+#endif /* COMMON_PACKETS_H */
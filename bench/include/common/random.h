@@ -0,0 +1,11 @@
+// Stand-in for Hercules' common/random.h, see bench/README.md.
+#ifndef COMMON_RANDOM_H
+#define COMMON_RANDOM_H
+
+#include "common/cbasetypes.h"
+
+// Seeded by the harness, so every run of a benchmark sees the same rolls
+int32 rnd(void);
+void rnd_seed(uint32 seed);
+
+#endif /* COMMON_RANDOM_H */
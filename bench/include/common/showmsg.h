@@ -0,0 +1,22 @@
+// Stand-in for Hercules' common/showmsg.h, see bench/README.md.
+// Messages go to stderr, so the benchmark tables on stdout stay clean.
+#ifndef COMMON_SHOWMSG_H
+#define COMMON_SHOWMSG_H
+
+#include <stdio.h>
+
+#define CL_RESET ""
+#define CL_WHITE ""
+#define CL_GREEN ""
+#define CL_RED ""
+
+#define ShowMessage(...) fprintf(stderr, __VA_ARGS__)
+#define ShowStatus(...) fprintf(stderr, "[Status] " __VA_ARGS__)
+#define ShowInfo(...) fprintf(stderr, "[Info] " __VA_ARGS__)
+#define ShowNotice(...) fprintf(stderr, "[Notice] " __VA_ARGS__)
+#define ShowWarning(...) fprintf(stderr, "[Warning] " __VA_ARGS__)
+#define ShowDebug(...) fprintf(stderr, "[Debug] " __VA_ARGS__)
+#define ShowError(...) fprintf(stderr, "[Error] " __VA_ARGS__)
+#define ShowFatalError(...) fprintf(stderr, "[Fatal Error] " __VA_ARGS__)
+
+#endif /* COMMON_SHOWMSG_H */
@@ -0,0 +1,33 @@
+// Stand-in for Hercules' common/socket.h, see bench/README.md.
+// Nothing is sent: the harness counts what would have been.
+#ifndef COMMON_SOCKET_H
+#define COMMON_SOCKET_H
+
+#include "common/cbasetypes.h"
+
+#include <time.h>
+
+#define FIFOSIZE_SERVERLINK 256 * 1024
+
+struct hplugin_data_store;
+
+struct socket_data {
+	uint32 client_addr;
+	void *session_data; // Player the connection belongs to
+	struct hplugin_data_store *hdata;
+	uint64 packets_sent; // Counted by the harness
+	uint64 bytes_sent;
+};
+
+struct socket_interface {
+	int fd_max;
+	time_t stall_time;
+	time_t last_tick;
+	struct socket_data **session;
+	bool (*session_is_active)(int fd);
+	bool (*session_is_valid)(int fd);
+};
+
+extern struct socket_interface *sockt;
+
+#endif /* COMMON_SOCKET_H */
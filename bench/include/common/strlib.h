@@ -0,0 +1,17 @@
+// Stand-in for Hercules' common/strlib.h, see bench/README.md.
+#ifndef COMMON_STRLIB_H
+#define COMMON_STRLIB_H
+
+#include "common/cbasetypes.h"
+
+#include <string.h>
+
+char *safestrncpy(char *dst, const char *src, size_t n);
+
+struct sv_interface {
+	bool (*readdb)(const char *directory, const char *filename, char delim, int mincols, int maxcols, int maxrows, bool (*parseproc)(char *fields[], int columns, int current));
+};
+
+extern struct sv_interface *sv;
+
+#endif /* COMMON_STRLIB_H */
@@ -0,0 +1,18 @@
+// Stand-in for Hercules' common/thread.h, see bench/README.md.
+// Backed by pthreads.
+#ifndef COMMON_THREAD_H
+#define COMMON_THREAD_H
+
+#include "common/cbasetypes.h"
+
+struct thread_handle;
+typedef void *(*threadFunc)(void *);
+
+struct thread_interface {
+	struct thread_handle *(*create)(threadFunc entry_point, void *param);
+	bool (*wait)(struct thread_handle *handle, void **out_exit_code);
+};
+
+extern struct thread_interface *thread;
+
+#endif /* COMMON_THREAD_H */
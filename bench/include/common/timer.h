@@ -0,0 +1,47 @@
+// Stand-in for Hercules' common/timer.h, see bench/README.md.
+// The harness clock only moves when a driver calls bench_tick().
+#ifndef COMMON_TIMER_H
+#define COMMON_TIMER_H
+
+#include "common/cbasetypes.h"
+
+#define DIFF_TICK(a, b) ((a) - (b))
+#define DIFF_TICK32(a, b) ((int32)((a) - (b)))
+
+#define INVALID_TIMER (-1)
+
+enum {
+	TIMER_ONCE_AUTODEL = 0x01,
+	TIMER_INTERVAL = 0x02,
+	TIMER_REMOVE_HEAP = 0x10,
+};
+
+typedef int (*TimerFunc)(int tid, int64 tick, int id, intptr_t data);
+#define TIMER_FUNC(x) int x(int tid, int64 tick, int id, intptr_t data)
+
+struct TimerData {
+	int64 tick;
+	TimerFunc func;
+	unsigned char type;
+	int interval;
+	int id;
+	intptr_t data;
+};
+
+struct timer_interface {
+	int64 (*gettick)(void);
+	int64 (*gettick_nocache)(void);
+	int (*add)(int64 tick, TimerFunc func, int id, intptr_t data);
+	int (*add_interval)(int64 tick, TimerFunc func, int id, intptr_t data, int interval);
+	const struct TimerData *(*get)(int tid);
+	int (*delete)(int tid, TimerFunc func);
+	int64 (*addtick)(int tid, int64 tick);
+	int64 (*settick)(int tid, int64 tick);
+	int (*add_func_list)(TimerFunc func, char *name);
+	unsigned long (*get_uptime)(void);
+	int (*perform)(int64 tick);
+};
+
+extern struct timer_interface *timer;
+
+#endif /* COMMON_TIMER_H */
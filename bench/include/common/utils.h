@@ -0,0 +1,7 @@
+// Stand-in for Hercules' common/utils.h, see bench/README.md.
+#ifndef COMMON_UTILS_H
+#define COMMON_UTILS_H
+
+#include "common/cbasetypes.h"
+
+#endif /* COMMON_UTILS_H */
@@ -0,0 +1,6 @@
+// Stand-in for Hercules' common/winapi.h, see bench/README.md.
+// Nothing from it is used off-server.
+#ifndef COMMON_WINAPI_H
+#define COMMON_WINAPI_H
+
+#endif /* COMMON_WINAPI_H */
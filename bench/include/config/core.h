@@ -0,0 +1,15 @@
+// Stand-in for Hercules' config/core.h, see bench/README.md.
+// Pre-renewal, as the plugins are meant for: RENEWAL, RENEWAL_DROP and
+// RENEWAL_EXP stay undefined.
+#ifndef CONFIG_CORE_H
+#define CONFIG_CORE_H
+
+#include <limits.h>
+
+#define DBPATH "pre-re/"
+#define DEFTYPE_MIN CHAR_MIN
+#define DEFTYPE_MAX CHAR_MAX
+typedef signed char defType;
+//#define AUTOLOOT_DISTANCE AREA_SIZE
+
+#endif /* CONFIG_CORE_H */
@@ -0,0 +1,15 @@
+// Stand-in for Hercules' map/achievement.h, see bench/README.md.
+#ifndef MAP_ACHIEVEMENT_H
+#define MAP_ACHIEVEMENT_H
+
+#include "common/cbasetypes.h"
+
+struct map_session_data;
+
+struct achievement_interface {
+	void (*validate_mob_kill)(struct map_session_data *sd, int mob_id);
+};
+
+extern struct achievement_interface *achievement;
+
+#endif /* MAP_ACHIEVEMENT_H */
@@ -0,0 +1,27 @@
+// Stand-in for Hercules' map/atcommand.h, see bench/README.md.
+#ifndef MAP_ATCOMMAND_H
+#define MAP_ATCOMMAND_H
+
+#include "common/HPMi.h"
+
+struct map_session_data;
+
+#define ACMD(x) static bool atcommand_ ## x (const int fd, struct map_session_data *sd, const char *command, const char *message, struct AtCommandInfo *info)
+
+#define msg_fd(fd, msg_number) (atcommand->msgfd((fd), (msg_number)))
+
+struct AtCommandInfo {
+	char command[50];
+	AtCommandFunc func;
+};
+
+struct atcommand_interface {
+	char at_symbol;
+	char char_symbol;
+	bool (*exec)(const int fd, struct map_session_data *sd, const char *message, bool player_invoked);
+	const char *(*msgfd)(int fd, int msg_number);
+};
+
+extern struct atcommand_interface *atcommand;
+
+#endif /* MAP_ATCOMMAND_H */
@@ -0,0 +1,60 @@
+// Stand-in for Hercules' map/battle.h, see bench/README.md.
+// Only the settings the plugins read, at their default values (see
+// bench/world.c).
+#ifndef MAP_BATTLE_H
+#define MAP_BATTLE_H
+
+#include "map/map.h"
+
+enum e_battle_check_target {
+	BCT_NOONE = 0x000000,
+	BCT_SELF = 0x010000,
+	BCT_ENEMY = 0x020000,
+	BCT_PARTY = 0x040000,
+	BCT_ALL = 0x3f0000,
+};
+
+struct Battle_Config {
+	int area_size;
+	int pk_mode;
+	int mob_ai;
+	int mob_chase_refresh;
+	int mob_npc_event_type;
+	int mob_size_influence;
+	int mobs_level_up;
+	int mobs_level_up_exp_rate;
+	int monster_loot_type;
+	int mvp_tomb_enabled;
+	int pvp_exp;
+	int zeny_from_mobs;
+	int exp_calc_type;
+	int exp_bonus_attacker;
+	int exp_bonus_max_attacker;
+	int pet_attack_exp_rate;
+	int pet_attack_exp_to_master;
+	int alchemist_summon_reward;
+	int allow_skill_without_day;
+	int delay_battle_damage;
+
+	// Drops
+	int logarithmic_drops;
+	int item_drop_adddrop_min, item_drop_adddrop_max;
+	int drop_rate0item;
+	int drops_by_luk;
+	int drops_by_luk2;
+	int autoloot_adjust;
+	int idle_no_autoloot;
+	int homunculus_autoloot;
+};
+
+struct battle_interface {
+	struct Battle_Config *bc;
+
+	bool (*check_range)(struct block_list *src, struct block_list *bl, int range);
+	int (*check_target)(struct block_list *src, struct block_list *target, int flag);
+	int (*get_target)(struct block_list *bl);
+};
+
+extern struct battle_interface *battle;
+
+#endif /* MAP_BATTLE_H */
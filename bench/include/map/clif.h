@@ -0,0 +1,53 @@
+// Stand-in for Hercules' map/clif.h, see bench/README.md.
+// Packets are not built: the harness counts them per connection.
+#ifndef MAP_CLIF_H
+#define MAP_CLIF_H
+
+#include "map/map.h"
+
+struct map_session_data;
+
+enum clr_type {
+	CLR_OUTSIGHT = 0,
+	CLR_DEAD,
+	CLR_RESPAWN,
+	CLR_TELEPORT,
+	CLR_TRICKDEAD,
+};
+
+#if PACKETVER_MAIN_NUM >= 20180207 || PACKETVER_RE_NUM >= 20171129 || PACKETVER_ZERO_NUM >= 20171130
+struct PACKET_ZC_ACK_REQNAME_TITLE {
+	int16 packet_id;
+	int32 gid;
+	int32 groupId;
+	char name[NAME_LENGTH];
+	char title[NAME_LENGTH];
+} __attribute__((packed));
+#define HEADER_ZC_ACK_REQNAME_TITLE 0x0adf
+#else
+struct PACKET_ZC_ACK_REQNAME_TITLE {
+	int16 packet_id;
+	int32 gid;
+	char name[NAME_LENGTH];
+} __attribute__((packed));
+#define HEADER_ZC_ACK_REQNAME_TITLE 0x0095
+#endif
+
+struct clif_interface {
+	void (*message)(const int fd, const char *mes);
+	void (*send_selforarea)(int fd, struct block_list *bl, const void *buf, int len);
+	void (*mobname_normal_ack)(int fd, struct block_list *bl);
+	void (*additem)(struct map_session_data *sd, int n, int amount, int fail);
+	void (*takeitem)(struct block_list *src, struct block_list *dst);
+	void (*clearunit_area)(struct block_list *bl, enum clr_type type);
+	void (*clearunit_delayed)(struct block_list *bl, enum clr_type type, int64 tick);
+	void (*item_drop_announce)(struct map_session_data *sd, int nameid, char *monsterName);
+	void (*mission_info)(struct map_session_data *sd, int mob_id, unsigned char progress);
+	void (*mvp_effect)(struct map_session_data *sd);
+	void (*mvp_exp)(struct map_session_data *sd, unsigned int exp);
+	void (*mvp_item)(struct map_session_data *sd, int nameid);
+};
+
+extern struct clif_interface *clif;
+
+#endif /* MAP_CLIF_H */
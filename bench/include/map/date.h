@@ -0,0 +1,6 @@
+// Stand-in for Hercules' map/date.h, see bench/README.md.
+// Nothing from it is used off-server.
+#ifndef MAP_DATE_H
+#define MAP_DATE_H
+
+#endif /* MAP_DATE_H */
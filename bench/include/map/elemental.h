@@ -0,0 +1,15 @@
+// Stand-in for Hercules' map/elemental.h, see bench/README.md.
+#ifndef MAP_ELEMENTAL_H
+#define MAP_ELEMENTAL_H
+
+#include "map/status.h"
+#include "map/unit.h"
+
+struct elemental_data {
+	struct block_list bl;
+	struct unit_data ud;
+	struct status_data base_status, battle_status;
+	struct map_session_data *master;
+};
+
+#endif /* MAP_ELEMENTAL_H */
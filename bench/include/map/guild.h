@@ -0,0 +1,19 @@
+// Stand-in for Hercules' map/guild.h, see bench/README.md.
+#ifndef MAP_GUILD_H
+#define MAP_GUILD_H
+
+#include "common/mmo.h"
+
+struct guild_castle {
+	int castle_id;
+	int mapindex;
+	char castle_name[NAME_LENGTH];
+};
+
+struct guild_interface {
+	void (*castledatasave)(int castle_id, int index, int value);
+};
+
+extern struct guild_interface *guild;
+
+#endif /* MAP_GUILD_H */
@@ -0,0 +1,54 @@
+// Stand-in for Hercules' map/homunculus.h, see bench/README.md.
+#ifndef MAP_HOMUNCULUS_H
+#define MAP_HOMUNCULUS_H
+
+#include "map/status.h"
+#include "map/unit.h"
+
+#define MAX_HOMUNCULUS_CLASS 52
+#define HM_CLASS_BASE 6001
+#define HM_CLASS_MAX (HM_CLASS_BASE + MAX_HOMUNCULUS_CLASS - 1)
+
+#define homun_alive(x) ((x) != NULL && (x)->homunculus.vaporize == 0 && (x)->battle_status.hp > 0)
+
+struct h_stats {
+	unsigned int HP, SP;
+	unsigned short str, agi, vit, int_, dex, luk;
+};
+
+struct s_homunculus_db {
+	int base_class, evo_class;
+	char name[NAME_LENGTH];
+	struct h_stats base, gmin, gmax, emin, emax;
+	int foodID;
+	int baseASPD;
+	long hungryDelay;
+	unsigned char element, race, base_size, evo_size;
+};
+
+struct homun_data {
+	struct block_list bl;
+	struct unit_data ud;
+	struct view_data *vd;
+	struct status_data base_status, battle_status;
+	struct status_change sc;
+	struct s_homunculus_db *homunculusDB;
+	struct s_homunculus homunculus;
+	struct map_session_data *master;
+	int hungry_timer;
+	unsigned int exp_next;
+	char blockskill[MAX_SKILL_DB];
+};
+
+struct homunculus_interface {
+	struct s_homunculus_db db[MAX_HOMUNCULUS_CLASS];
+	void (*reload)(void);
+	bool (*levelup)(struct homun_data *hd);
+	bool (*evolve)(struct homun_data *hd);
+	bool (*delete)(struct homun_data *hd, int emote);
+	bool (*gainexp)(struct homun_data *hd, unsigned int exp);
+};
+
+extern struct homunculus_interface *homun;
+
+#endif /* MAP_HOMUNCULUS_H */
@@ -0,0 +1,6 @@
+// Stand-in for Hercules' map/intif.h, see bench/README.md.
+// Nothing from it is used off-server.
+#ifndef MAP_INTIF_H
+#define MAP_INTIF_H
+
+#endif /* MAP_INTIF_H */
@@ -0,0 +1,46 @@
+// Stand-in for Hercules' map/itemdb.h, see bench/README.md.
+#ifndef MAP_ITEMDB_H
+#define MAP_ITEMDB_H
+
+#include "common/mmo.h"
+
+#define MAX_ITEMDB 0x10000
+#define MAX_ITEMRATIO_MOBS 10
+
+enum item_chain_cache {
+	ECC_ORE,
+	ECC_MAX,
+};
+
+struct item_data {
+	int nameid;
+	char name[NAME_LENGTH], jname[NAME_LENGTH];
+	int value_buy;
+	int value_sell;
+	int type;
+	int weight;
+	struct {
+		unsigned int no_refine : 1;
+		unsigned int delay_consume : 1;
+		unsigned int trade_restriction : 9;
+		unsigned int autoequip : 1;
+		unsigned int buyingstore : 1;
+		unsigned int bindonequip : 1;
+		unsigned int keepafteruse : 1;
+		unsigned int force_serial : 1;
+	} flag;
+};
+
+struct itemdb_interface {
+	unsigned short chain_cache[ECC_MAX];
+
+	struct item_data *(*search)(int nameid);
+	struct item_data *(*exists)(int nameid);
+	int (*isidentified)(int nameid);
+	int (*isidentified2)(struct item_data *data);
+	int (*chain_item)(unsigned short chain_id, int *rate);
+};
+
+extern struct itemdb_interface *itemdb;
+
+#endif /* MAP_ITEMDB_H */
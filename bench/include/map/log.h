@@ -0,0 +1,41 @@
+// Stand-in for Hercules' map/log.h, see bench/README.md.
+#ifndef MAP_LOG_H
+#define MAP_LOG_H
+
+#include "common/cbasetypes.h"
+
+struct item;
+struct item_data;
+struct map_session_data;
+struct mob_data;
+
+enum e_log_pick_type {
+	LOG_TYPE_NONE = 0,
+	LOG_TYPE_TRADE = 0x00001,
+	LOG_TYPE_VENDING = 0x00002,
+	LOG_TYPE_PICKDROP_PLAYER = 0x00004,
+	LOG_TYPE_PICKDROP_MONSTER = 0x00008,
+	LOG_TYPE_NPC = 0x00010,
+	LOG_TYPE_SCRIPT = 0x00020,
+	LOG_TYPE_STEAL = 0x00040,
+	LOG_TYPE_CONSUME = 0x00080,
+	LOG_TYPE_PRODUCE = 0x00100,
+	LOG_TYPE_MVP = 0x00200,
+	LOG_TYPE_COMMAND = 0x00400,
+	LOG_TYPE_STORAGE = 0x00800,
+	LOG_TYPE_GSTORAGE = 0x01000,
+	LOG_TYPE_MAIL = 0x02000,
+	LOG_TYPE_AUCTION = 0x04000,
+	LOG_TYPE_BUYING_STORE = 0x08000,
+	LOG_TYPE_OTHER = 0x10000,
+	LOG_TYPE_LOOT = LOG_TYPE_PICKDROP_MONSTER|LOG_TYPE_CONSUME,
+};
+
+struct log_interface {
+	void (*pick_mob)(struct mob_data *md, enum e_log_pick_type type, int amount, struct item *itm, struct item_data *data);
+	void (*mvpdrop)(struct map_session_data *sd, int monster_id, int *log_mvp);
+};
+
+extern struct log_interface *logs;
+
+#endif /* MAP_LOG_H */
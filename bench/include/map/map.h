@@ -0,0 +1,226 @@
+// Stand-in for Hercules' map/map.h, see bench/README.md.
+// Blocks are kept in BLOCK_SIZE cells per map as in Hercules, so the
+// area searches a plugin triggers cost about what they cost there.
+#ifndef MAP_MAP_H
+#define MAP_MAP_H
+
+#include "common/mmo.h"
+#include "common/db.h"
+
+#include <stdarg.h>
+
+struct map_session_data;
+struct mob_data;
+struct homun_data;
+struct pet_data;
+struct mercenary_data;
+struct elemental_data;
+struct npc_data;
+struct chat_data;
+struct skill_unit;
+struct hplugin_data_store;
+
+#define MAX_MAP_PER_SERVER 1500
+#define BLOCK_SIZE 8
+#define AREA_SIZE 14
+#define MAX_FLOORITEM START_ACCOUNT_NUM
+#define START_ACCOUNT_NUM 2000000
+#define MAX_IGNORE_LIST 20
+
+enum bl_type {
+	BL_NUL = 0x000,
+	BL_PC = 0x001,
+	BL_MOB = 0x002,
+	BL_PET = 0x004,
+	BL_HOM = 0x008,
+	BL_MER = 0x010,
+	BL_ITEM = 0x020,
+	BL_SKILL = 0x040,
+	BL_NPC = 0x080,
+	BL_CHAT = 0x100,
+	BL_ELEM = 0x200,
+
+	BL_ALL = 0xFFF,
+};
+
+#define BL_CHAR (BL_PC|BL_MOB|BL_HOM|BL_MER|BL_ELEM)
+
+enum Race {
+	RC_FORMLESS = 0,
+	RC_UNDEAD,
+	RC_BRUTE,
+	RC_PLANT,
+	RC_INSECT,
+	RC_FISH,
+	RC_DEMON,
+	RC_DEMIHUMAN,
+	RC_ANGEL,
+	RC_DRAGON,
+	RC_PLAYER,
+	RC_BOSS,
+	RC_NONBOSS,
+	RC_MAX,
+};
+
+enum RaceMask {
+	RCMASK_NONE = 0,
+	RCMASK_FORMLESS = 1 << RC_FORMLESS,
+	RCMASK_ALL = (1 << RC_MAX) - 1,
+};
+
+enum size_type {
+	SZ_SMALL = 0,
+	SZ_MEDIUM,
+	SZ_BIG,
+};
+
+typedef enum {
+	CELL_WALKABLE,
+	CELL_SHOOTABLE,
+	CELL_WATER,
+	CELL_NPC,
+	CELL_BASILICA,
+	CELL_LANDPROTECTOR,
+	CELL_NOVENDING,
+	CELL_NOCHAT,
+	CELL_ICEWALL,
+	CELL_NOICEWALL,
+} cell_t;
+
+typedef enum {
+	CELL_GETTYPE,
+	CELL_CHKWALL,
+	CELL_CHKWATER,
+	CELL_CHKCLIFF,
+	CELL_CHKPASS,
+	CELL_CHKREACH,
+	CELL_CHKNOPASS,
+	CELL_CHKNOREACH,
+	CELL_CHKSTACK,
+	CELL_CHKNPC,
+	CELL_CHKBASILICA,
+	CELL_CHKLANDPROTECTOR,
+	CELL_CHKNOVENDING,
+	CELL_CHKNOCHAT,
+	CELL_CHKICEWALL,
+	CELL_CHKNOICEWALL,
+} cell_chk;
+
+struct block_list {
+	struct block_list *next, *prev;
+	int id;
+	int16 m, x, y;
+	enum bl_type type;
+};
+
+struct flooritem_data {
+	struct block_list bl;
+	unsigned char subx, suby;
+	int cleartimer;
+	int first_get_charid, second_get_charid, third_get_charid;
+	int64 first_get_tick, second_get_tick, third_get_tick;
+	struct item item_data;
+};
+
+struct spawn_data {
+	short class_;
+	unsigned short m, x, y;
+	signed short xs, ys;
+	unsigned short num;
+	unsigned short active;
+	unsigned int delay1, delay2;
+	struct {
+		unsigned int size : 2;
+		unsigned int ai : 4;
+		unsigned int dynamic : 1;
+		unsigned int boss : 1;
+	} state;
+	char name[NAME_LENGTH], eventname[50];
+};
+
+struct map_data {
+	char name[MAP_NAME_LENGTH];
+	uint16 index;
+	uint8 *cell; // Walkable if 0, one byte per cell
+	struct block_list **block; // Head of the block list of each BLOCK_SIZE cell
+	struct block_list **block_mob;
+	int16 m;
+	int16 xs, ys;
+	int16 bxs, bys;
+	int users;
+	int npc_num;
+	struct {
+		unsigned int pvp : 1;
+		unsigned int nobaseexp : 1;
+		unsigned int nojobexp : 1;
+		unsigned int nomobloot : 1;
+		unsigned int nomvploot : 1;
+		unsigned int notomb : 1;
+		unsigned int nodrop : 1;
+	} flag;
+	int bexp, jexp;
+	struct hplugin_data_store *hdata;
+};
+
+struct map_interface {
+	int count;
+	struct map_data *list;
+	char *db_path;
+	int autosave_interval;
+
+	// Blocks
+	int (*addblock)(struct block_list *bl);
+	int (*delblock)(struct block_list *bl);
+	int (*moveblock)(struct block_list *bl, int x1, int y1, int64 tick);
+	int (*freeblock_lock)(void);
+	int (*freeblock_unlock)(void);
+	void (*addiddb)(struct block_list *bl);
+	void (*deliddb)(struct block_list *bl);
+	struct block_list *(*id2bl)(int id);
+	struct mob_data *(*id2md)(int id);
+	struct map_session_data *(*id2sd)(int id);
+	struct map_session_data *(*charid2sd)(int charid);
+
+	// Area searches
+	int (*foreachinrange)(int (*func)(struct block_list *, va_list), struct block_list *center, int16 range, int type, ...);
+	int (*foreachinarea)(int (*func)(struct block_list *, va_list), int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int type, ...);
+	int (*foreachpc)(int (*func)(struct map_session_data *sd, va_list args), ...);
+	int (*foreachmob)(int (*func)(struct mob_data *md, va_list args), ...);
+
+	// Cells
+	int (*getcell)(int16 m, const struct block_list *bl, int16 x, int16 y, cell_chk cellchk);
+	void (*setcell)(int16 m, int16 x, int16 y, cell_t cell, bool flag);
+	void (*setgatcell)(int16 m, int16 x, int16 y, int gat);
+
+	// Floor items
+	int (*addflooritem)(const struct block_list *bl, struct item *item_data, int amount, int16 m, int16 x, int16 y, int first_charid, int second_charid, int third_charid, int flags, bool showdropeffect);
+	int (*clearflooritem_timer)(int tid, int64 tick, int id, intptr_t data);
+	void (*clearflooritem)(struct block_list *bl);
+
+	int (*race_id2mask)(int race);
+};
+
+extern struct map_interface *map;
+
+typedef struct map_session_data T_BL_PC;
+typedef struct mob_data T_BL_MOB;
+typedef struct homun_data T_BL_HOM;
+typedef struct pet_data T_BL_PET;
+typedef struct mercenary_data T_BL_MER;
+typedef struct elemental_data T_BL_ELEM;
+typedef struct flooritem_data T_BL_ITEM;
+typedef struct npc_data T_BL_NPC;
+typedef struct chat_data T_BL_CHAT;
+typedef struct skill_unit T_BL_SKILL;
+
+#define BL_CAST(type_, bl) (((bl) == (struct block_list *)NULL || (bl)->type != (type_)) ? (T_ ## type_ *)NULL : (T_ ## type_ *)(bl))
+#define BL_CCAST(type_, bl) (((bl) == (const struct block_list *)NULL || (bl)->type != (type_)) ? (const T_ ## type_ *)NULL : (const T_ ## type_ *)(bl))
+#define BL_UCAST(type_, bl) ((T_ ## type_ *)(bl))
+#define BL_UCCAST(type_, bl) ((const T_ ## type_ *)(bl))
+
+// Checks that map->freeblock_lock calls are paired in debug builds of Hercules
+#define GUARD_MAP_LOCK
+
+#define DEFAULT_ENEMY_TYPE(md) ((md)->special_state.ai != AI_NONE ? BL_CHAR : BL_MOB|BL_PC|BL_HOM|BL_MER)
+
+#endif /* MAP_MAP_H */
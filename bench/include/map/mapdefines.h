@@ -0,0 +1,6 @@
+// Stand-in for Hercules' map/mapdefines.h, see bench/README.md.
+// Nothing from it is used off-server.
+#ifndef MAP_MAPDEFINES_H
+#define MAP_MAPDEFINES_H
+
+#endif /* MAP_MAPDEFINES_H */
@@ -0,0 +1,22 @@
+// Stand-in for Hercules' map/mercenary.h, see bench/README.md.
+#ifndef MAP_MERCENARY_H
+#define MAP_MERCENARY_H
+
+#include "map/status.h"
+#include "map/unit.h"
+
+struct mercenary_data {
+	struct block_list bl;
+	struct unit_data ud;
+	struct status_data base_status, battle_status;
+	struct map_session_data *master;
+	int kill_count;
+};
+
+struct mercenary_interface {
+	int (*kills)(struct mercenary_data *md);
+};
+
+extern struct mercenary_interface *mercenary;
+
+#endif /* MAP_MERCENARY_H */
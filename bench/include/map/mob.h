@@ -0,0 +1,225 @@
+// Stand-in for Hercules' map/mob.h, see bench/README.md.
+#ifndef MAP_MOB_H
+#define MAP_MOB_H
+
+#include "map/map.h"
+#include "map/status.h"
+#include "map/unit.h"
+
+#include <time.h>
+
+struct item_data;
+struct guild_castle;
+
+#define MAX_MOB_DB 5000
+#define MAX_RANDOMMONSTER 5
+#define MAX_MOBSKILL 50
+#define DAMAGELOG_SIZE 30
+#define LOOTITEM_SIZE 10
+#define EVENT_NAME_LENGTH (NAME_LENGTH * 2 + 3)
+#define MOB_CLONE_START (MAX_MOB_DB - 999)
+#define MOB_CLONE_END MAX_MOB_DB
+
+#define MIN_MOBTHINKTIME 100
+#define MIN_RANDOMWALKTIME 4000
+#define RUDE_ATTACKED_COUNT 2
+
+enum mob_ai {
+	AI_NONE = 0,
+	AI_ATTACK,
+	AI_SPHERE,
+	AI_FLORA,
+	AI_ZANZOU,
+	AI_LEGION,
+	AI_FAW,
+	AI_MAX,
+};
+
+enum MobSkillState {
+	MSS_ANY = -1,
+	MSS_IDLE,
+	MSS_WALK,
+	MSS_LOOT,
+	MSS_DEAD,
+	MSS_BERSERK,
+	MSS_ANGRY,
+	MSS_RUSH,
+	MSS_FOLLOW,
+	MSS_ANYTARGET,
+};
+
+enum MobSkillCondition {
+	MSC_ALWAYS = 0,
+	MSC_MYHPLTMAXRATE,
+	MSC_RUDEATTACKED = 14,
+	MSC_SLAVELE,
+};
+
+enum mob_damage_log_flag {
+	MDLF_NORMAL = 0,
+	MDLF_HOMUN,
+	MDLF_PET,
+	MDLF_SELF,
+};
+
+enum mob_id {
+	MOBID_PORING = 1002,
+	MOBID_EMPELIUM = 1288,
+};
+
+enum mob_bosstype {
+	BTYPE_NONE,
+	BTYPE_BOSS,
+	BTYPE_MVP,
+};
+
+struct optdrop_group {
+	struct item_option options[MAX_ITEM_OPTIONS];
+	int optioncount;
+};
+
+struct mob_drop {
+	int nameid;
+	int p;
+	struct optdrop_group *options;
+};
+
+struct mob_db {
+	int mob_id;
+	char sprite[NAME_LENGTH], name[NAME_LENGTH], jname[NAME_LENGTH];
+	unsigned int base_exp, job_exp;
+	unsigned int mexp;
+	short range2, range3;
+	short race2;
+	unsigned short lv;
+	struct mob_drop dropitem[MAX_MOB_DROP];
+	struct mob_drop mvpitem[MAX_MVP_DROP];
+	struct status_data status;
+	struct view_data vd;
+	unsigned int option;
+	int maxskill;
+	int dmg_mod;
+	struct hplugin_data_store *hdata;
+};
+
+struct item_drop {
+	struct item item_data;
+	bool showdropeffect;
+	struct item_drop *next;
+};
+
+struct item_drop_list {
+	int16 m, x, y;
+	int first_charid, second_charid, third_charid;
+	struct item_drop *item;
+};
+
+struct guardian_data {
+	int number; // 0-MAX_GUARDIANS-1 = Guardians. MAX_GUARDIANS = Emperium.
+	int guild_id;
+	int emblem_id;
+	int guardup_lv;
+	char guild_name[NAME_LENGTH];
+	struct guild_castle *castle;
+};
+
+struct mob_data {
+	struct block_list bl;
+	struct unit_data ud;
+	struct view_data *vd;
+	struct status_data status, *base_status;
+	struct status_change sc;
+	struct mob_db *db;
+	char name[NAME_LENGTH];
+	struct hplugin_data_store *hdata;
+	struct spawn_data *spawn;
+	struct guardian_data *guardian_data;
+	struct {
+		unsigned int size : 2;
+		unsigned int ai : 4;
+		unsigned int clone : 1;
+	} special_state;
+	struct {
+		unsigned int aggressive : 1;
+		unsigned int steal_coin_flag : 1;
+		unsigned int soul_change_flag : 1;
+		unsigned int alchemist : 1;
+		unsigned int spotted : 1;
+		unsigned int npc_killmonster : 1;
+		unsigned int rebirth : 1;
+		unsigned int boss : 1;
+		enum MobSkillState skillstate;
+		unsigned char steal_flag;
+		unsigned char attacked_count;
+		int provoke_flag;
+		unsigned int killer : 1;
+	} state;
+	struct {
+		int id;
+		unsigned int dmg;
+		unsigned int flag : 2;
+	} dmglog[DAMAGELOG_SIZE];
+	uint32 tdmg;
+	struct item *lootitem;
+	short class_;
+	unsigned short level;
+	unsigned short lootitem_count;
+	int16 min_chase;
+	int deletetimer;
+	int master_id, master_dist;
+	int target_id, attacked_id;
+	int64 next_walktime, last_thinktime, last_linktime, last_pcneartime, dmgtick;
+	short move_fail_count;
+	short walktoxy_fail_count;
+	int bg_id;
+	int spawn_timer;
+	char npc_event[EVENT_NAME_LENGTH];
+	unsigned int can_summon : 1;
+};
+
+struct mob_interface {
+	struct mob_db *db_data[MAX_MOB_DB + 1];
+	struct mob_db *dummy;
+
+	struct mob_db *(*db)(int index);
+	int (*spawn)(struct mob_data *md);
+	int (*setdelayspawn)(struct mob_data *md);
+	void (*reload)(void);
+	int (*dead)(struct mob_data *md, struct block_list *src, int type);
+	void (*damage)(struct mob_data *md, struct block_list *src, int damage);
+	void (*heal)(struct mob_data *md, unsigned int heal);
+	void (*log_damage)(struct mob_data *md, struct block_list *src, int damage);
+	int (*timer_delete)(int tid, int64 tick, int id, intptr_t data);
+	int (*deleteslave)(struct mob_data *md);
+	bool (*is_clone)(int class_);
+	int (*get_random_id)(int type, int flag, int lv);
+	void (*mvptomb_create)(struct mob_data *md, char *killer, time_t time);
+
+	// AI
+	int (*ai_hard)(int tid, int64 tick, int id, intptr_t data);
+	int (*ai_sub_foreachclient)(struct map_session_data *sd, va_list ap);
+	int (*ai_sub_hard_timer)(struct block_list *bl, va_list ap);
+	bool (*ai_sub_hard)(struct mob_data *md, int64 tick);
+	int (*ai_sub_hard_activesearch)(struct block_list *bl, va_list ap);
+	int (*ai_sub_hard_changechase)(struct block_list *bl, va_list ap);
+	int (*ai_sub_hard_bg_ally)(struct block_list *bl, va_list ap);
+	int (*ai_sub_hard_lootsearch)(struct block_list *bl, va_list ap);
+	int (*ai_sub_hard_slavemob)(struct mob_data *md, int64 tick);
+	bool (*can_reach)(struct mob_data *md, struct block_list *bl, int range, int state);
+	bool (*can_changetarget)(const struct mob_data *md, const struct block_list *target, uint32 mode);
+	int (*unlocktarget)(struct mob_data *md, int64 tick);
+	bool (*warpchase)(struct mob_data *md, struct block_list *target);
+	int (*use_skill)(struct mob_data *md, int64 tick, int event);
+
+	// Drops
+	unsigned int (*drop_adjust)(int baserate, int rate_adjust, unsigned short rate_min, unsigned short rate_max);
+	struct item_drop *(*setdropitem)(int nameid, struct optdrop_group *options, int qty, struct item_data *data);
+	void (*setdropitem_options)(struct item *item, struct optdrop_group *options);
+	struct item_drop *(*setlootitem)(struct item *item);
+	void (*item_drop)(struct mob_data *md, struct item_drop_list *dlist, struct item_drop *ditem, int loot, int drop_rate, unsigned short flag);
+	int (*delay_item_drop)(int tid, int64 tick, int id, intptr_t data);
+};
+
+extern struct mob_interface *mob;
+
+#endif /* MAP_MOB_H */
@@ -0,0 +1,29 @@
+// Stand-in for Hercules' map/npc.h, see bench/README.md.
+#ifndef MAP_NPC_H
+#define MAP_NPC_H
+
+#include "common/cbasetypes.h"
+
+struct map_session_data;
+
+enum npce_event {
+	NPCE_LOGIN,
+	NPCE_LOGOUT,
+	NPCE_LOADMAP,
+	NPCE_BASELVUP,
+	NPCE_JOBLVUP,
+	NPCE_DIE,
+	NPCE_KILLPC,
+	NPCE_KILLNPC,
+	NPCE_MAX,
+};
+
+struct npc_interface {
+	int (*event)(struct map_session_data *sd, const char *eventname, int ontouch);
+	int (*event_do)(const char *name);
+	int (*script_event)(struct map_session_data *sd, enum npce_event type);
+};
+
+extern struct npc_interface *npc;
+
+#endif /* MAP_NPC_H */
@@ -0,0 +1,30 @@
+// Stand-in for Hercules' map/party.h, see bench/README.md.
+#ifndef MAP_PARTY_H
+#define MAP_PARTY_H
+
+#include "common/mmo.h"
+
+struct block_list;
+struct map_session_data;
+
+struct party {
+	int party_id;
+	char name[NAME_LENGTH];
+	unsigned char count;
+	unsigned exp : 1,
+		item : 2;
+};
+
+struct party_data {
+	struct party party;
+};
+
+struct party_interface {
+	struct party_data *(*search)(int party_id);
+	int (*exp_share)(struct party_data *p, struct block_list *src, unsigned int base_exp, unsigned int job_exp, int zeny);
+	int (*share_loot)(struct party_data *p, struct map_session_data *sd, struct item *item_data, int first_charid);
+};
+
+extern struct party_interface *party;
+
+#endif /* MAP_PARTY_H */
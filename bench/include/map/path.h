@@ -0,0 +1,51 @@
+// Stand-in for Hercules' map/path.h, see bench/README.md.
+// path->search walks straight and then slides along walls, which is
+// enough for the synthetic maps of the benchmarks.
+#ifndef MAP_PATH_H
+#define MAP_PATH_H
+
+#include "map/map.h"
+
+#define MAX_WALKPATH 32
+
+enum directions {
+	UNIT_DIR_NORTH = 0,
+	UNIT_DIR_NORTHWEST,
+	UNIT_DIR_WEST,
+	UNIT_DIR_SOUTHWEST,
+	UNIT_DIR_SOUTH,
+	UNIT_DIR_SOUTHEAST,
+	UNIT_DIR_EAST,
+	UNIT_DIR_NORTHEAST,
+	UNIT_DIR_MAX,
+};
+
+struct walkpath_data {
+	unsigned char path_len, path_pos;
+	enum directions path[MAX_WALKPATH];
+};
+
+struct shootpath_data {
+	int rx, ry, len;
+	int x[MAX_WALKPATH];
+	int y[MAX_WALKPATH];
+};
+
+#define check_distance_bl(bl1, bl2, distance) (path->check_distance((bl1)->x - (bl2)->x, (bl1)->y - (bl2)->y, (distance)))
+#define check_distance_blxy(bl, x1, y1, distance) (path->check_distance((bl)->x - (x1), (bl)->y - (y1), (distance)))
+#define check_distance_xy(x0, y0, x1, y1, distance) (path->check_distance((x0) - (x1), (y0) - (y1), (distance)))
+#define distance_bl(bl1, bl2) (path->distance((bl1)->x - (bl2)->x, (bl1)->y - (bl2)->y))
+#define distance_blxy(bl, x1, y1) (path->distance((bl)->x - (x1), (bl)->y - (y1)))
+#define distance_xy(x0, y0, x1, y1) (path->distance((x0) - (x1), (y0) - (y1)))
+
+struct path_interface {
+	bool (*blownpos)(struct block_list *bl, int16 m, int16 x0, int16 y0, int16 dx, int16 dy, int count);
+	bool (*search)(struct walkpath_data *wpd, struct block_list *bl, int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int flag, cell_chk cell);
+	bool (*search_long)(struct shootpath_data *spd, struct block_list *bl, int16 m, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cell);
+	bool (*check_distance)(int dx, int dy, int distance);
+	unsigned int (*distance)(int dx, int dy);
+};
+
+extern struct path_interface *path;
+
+#endif /* MAP_PATH_H */
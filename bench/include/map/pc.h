@@ -0,0 +1,111 @@
+// Stand-in for Hercules' map/pc.h, see bench/README.md.
+#ifndef MAP_PC_H
+#define MAP_PC_H
+
+#include "map/homunculus.h"
+#include "map/map.h"
+#include "map/status.h"
+#include "map/unit.h"
+
+#include <time.h>
+
+struct mercenary_data;
+struct pet_data;
+struct item_data;
+
+enum e_pc_permission {
+	PC_PERM_NONE = 0,
+	PC_PERM_TRADE = 0x00000001,
+	PC_PERM_PARTY = 0x00000002,
+	PC_PERM_ALL_SKILL = 0x00000004,
+	PC_PERM_USE_ALL_EQUIPMENT = 0x00000008,
+	PC_PERM_SKILL_UNCONDITIONAL = 0x00000010,
+	PC_PERM_USE_ALL_COMMANDS = 0x00000020,
+};
+
+enum fame_list_type {
+	RANKTYPE_BLACKSMITH = 0,
+	RANKTYPE_ALCHEMIST,
+	RANKTYPE_TAEKWON,
+	RANKTYPE_PK,
+};
+
+enum status_point_types {
+	SP_BASELEVEL = 11,
+	SP_KILLERRID = 118,
+	SP_KILLEDRID = 122,
+};
+
+struct s_add_drop {
+	int id;
+	short is_group;
+	int rate;
+	int race;
+	int class_;
+};
+
+struct sg_data {
+	short anger_id;
+	short bless_id;
+	short comfort_id;
+	char feel_var[NAME_LENGTH];
+	char hate_var[NAME_LENGTH];
+	bool (*day_func)(void);
+};
+
+struct map_session_data {
+	struct block_list bl;
+	struct unit_data ud;
+	struct view_data vd;
+	struct status_data base_status, battle_status;
+	struct status_change sc;
+	struct mmo_charstatus status;
+	struct hplugin_data_store *hdata;
+	int fd;
+	unsigned int permissions; // e_pc_permission of the group of the player
+	struct {
+		unsigned int active : 1;
+		unsigned int dead_sit : 2;
+		unsigned int gangsterparadise : 1;
+		unsigned int autoloot;
+	} state;
+	time_t idletime;
+	int invincible_timer;
+	int hate_mob[MAX_PC_FEELHATE];
+	int dropaddrace[RC_MAX];
+	struct s_add_drop add_drop[MAX_PC_BONUS];
+	struct {
+		int get_zeny_rate;
+		int get_zeny_num;
+	} bonus;
+	int mission_mobid;
+	int mission_count;
+	int avail_quests;
+	struct homun_data *hd;
+	struct pet_data *pd;
+	struct mercenary_data *md;
+	struct elemental_data *ed;
+};
+
+#define pc_isdead(sd) ((sd)->state.dead_sit == 1)
+#define pc_has_permission(sd, permission) (((sd)->permissions & (permission)) != 0)
+#define pc_setglobalreg(sd, reg, val) (pc->setregistry((sd), (reg), (val)))
+
+struct pc_interface {
+	struct sg_data sg_info[MAX_PC_FEELHATE];
+
+	bool (*db_checkid)(int class);
+	int (*checkskill)(struct map_session_data *sd, uint16 skill_id);
+	int (*isautolooting)(struct map_session_data *sd, int nameid);
+	int (*level_penalty_mod)(int diff, unsigned char race, uint32 mode, int type);
+	int (*additem)(struct map_session_data *sd, const struct item *item_data, int amount, int log_type);
+	int (*getzeny)(struct map_session_data *sd, int zeny, int type, struct map_session_data *tsd);
+	bool (*gainexp)(struct map_session_data *sd, struct block_list *src, uint64 base_exp, uint64 job_exp, bool is_quest);
+	int (*addfame)(struct map_session_data *sd, int ranktype, int count);
+	int (*setparam)(struct map_session_data *sd, int type, int val);
+	int (*setregistry)(struct map_session_data *sd, int64 reg, int val);
+};
+
+extern struct pc_interface *pc;
+
+#endif /* MAP_PC_H */
@@ -0,0 +1,22 @@
+// Stand-in for Hercules' map/pet.h, see bench/README.md.
+#ifndef MAP_PET_H
+#define MAP_PET_H
+
+#include "map/status.h"
+#include "map/unit.h"
+
+struct pet_data {
+	struct block_list bl;
+	struct unit_data ud;
+	struct view_data vd;
+	struct status_data status;
+	struct map_session_data *msd;
+};
+
+struct pet_interface {
+	int (*create_egg)(struct map_session_data *sd, int item_id);
+};
+
+extern struct pet_interface *pet;
+
+#endif /* MAP_PET_H */
@@ -0,0 +1,20 @@
+// Stand-in for Hercules' map/quest.h, see bench/README.md.
+#ifndef MAP_QUEST_H
+#define MAP_QUEST_H
+
+#include "common/cbasetypes.h"
+
+#include <stdarg.h>
+
+struct block_list;
+struct map_session_data;
+struct mob_data;
+
+struct quest_interface {
+	void (*update_objective)(struct map_session_data *sd, const struct mob_data *md);
+	int (*update_objective_sub)(struct block_list *bl, va_list ap);
+};
+
+extern struct quest_interface *quest;
+
+#endif /* MAP_QUEST_H */
@@ -0,0 +1,13 @@
+// Stand-in for Hercules' map/script.h, see bench/README.md.
+#ifndef MAP_SCRIPT_H
+#define MAP_SCRIPT_H
+
+#include "common/cbasetypes.h"
+
+struct script_interface {
+	int64 (*add_variable)(const char *varname);
+};
+
+extern struct script_interface *script;
+
+#endif /* MAP_SCRIPT_H */
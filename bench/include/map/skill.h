@@ -0,0 +1,15 @@
+// Stand-in for Hercules' map/skill.h, see bench/README.md.
+#ifndef MAP_SKILL_H
+#define MAP_SKILL_H
+
+#include "common/cbasetypes.h"
+
+enum e_skill {
+	NV_BASIC = 1,
+	BS_FINDINGORE = 114,
+	SG_SUN_BLESS = 1006,
+	SG_MOON_BLESS,
+	SG_STAR_BLESS,
+};
+
+#endif /* MAP_SKILL_H */
@@ -0,0 +1,134 @@
+// Stand-in for Hercules' map/status.h, see bench/README.md.
+// Only the status changes the plugins look at are listed.
+#ifndef MAP_STATUS_H
+#define MAP_STATUS_H
+
+#include "map/map.h"
+
+typedef enum sc_type {
+	SC_NONE = -1,
+	SC_STONE = 0,
+	SC_FREEZE,
+	SC_STUN,
+	SC_SLEEP,
+	SC_POISON,
+	SC_CURSE,
+	SC_SILENCE,
+	SC_CONFUSION,
+	SC_BLIND,
+	SC_BLOODING,
+	SC_DPOISON,
+	SC_KAIZEL,
+	SC_MIRACLE,
+	SC_REBIRTH,
+	SC_RICHMANKIM,
+	SC_CASH_RECEIVEITEM,
+	SC_OVERLAPEXPUP,
+	SC_BLADESTOP,
+	SC_SPIDERWEB,
+	SC_CURSEDCIRCLE_TARGET,
+	SC_DEEP_SLEEP,
+	SC_THORNS_TRAP,
+	SC_VACUUM_EXTREME,
+	SC_WUGBITE,
+	SC__CHAOS,
+	SC__MANHOLE,
+	SC_MAX,
+} sc_type;
+
+enum e_mode {
+	MD_NONE = 0x00000000,
+	MD_CANMOVE = 0x00000001,
+	MD_LOOTER = 0x00000002,
+	MD_AGGRESSIVE = 0x00000004,
+	MD_ASSIST = 0x00000008,
+	MD_CASTSENSOR_IDLE = 0x00000010,
+	MD_BOSS = 0x00000020,
+	MD_PLANT = 0x00000040,
+	MD_CANATTACK = 0x00000080,
+	MD_DETECTOR = 0x00000100,
+	MD_CASTSENSOR_CHASE = 0x00000200,
+	MD_CHANGECHASE = 0x00000400,
+	MD_ANGRY = 0x00000800,
+	MD_CHANGETARGET_MELEE = 0x00001000,
+	MD_CHANGETARGET_CHASE = 0x00002000,
+	MD_TARGETWEAK = 0x00004000,
+	MD_NOKNOCKBACK = 0x00008000,
+	MD_RANDOMTARGET = 0x00010000,
+	MD_MASK = 0x0001FFFF,
+};
+
+enum sc_opt1 {
+	OPT1_STONE = 1,
+	OPT1_FREEZE,
+	OPT1_STUN,
+	OPT1_SLEEP,
+	OPT1_STONEWAIT = 6,
+	OPT1_BURNING,
+	OPT1_IMPRISON,
+	OPT1_CRYSTALIZE,
+};
+
+enum e_option {
+	OPTION_NOTHING = 0x00000000,
+	OPTION_SIGHT = 0x00000001,
+	OPTION_HIDE = 0x00000002,
+	OPTION_CLOAK = 0x00000004,
+	OPTION_INVISIBLE = 0x00000040,
+};
+
+struct weapon_atk {
+	unsigned short atk, atk2;
+	unsigned short range;
+	unsigned char ele;
+};
+
+struct status_data {
+	uint32 hp, sp, max_hp, max_sp;
+	uint16 str, agi, vit, int_, dex, luk;
+	uint16 batk, matk_min, matk_max, speed;
+	short amotion, adelay, dmotion;
+	uint32 mode;
+	short hit, flee, cri, flee2;
+	defType def, mdef;
+	unsigned char def_ele, ele_lv, size, race;
+	struct weapon_atk rhw, lhw;
+};
+
+struct status_change_entry {
+	int timer;
+	int val1, val2, val3, val4;
+	int total_tick;
+};
+
+struct status_change {
+	unsigned int option;
+	unsigned int opt3;
+	short opt1;
+	short opt2;
+	unsigned char count;
+	struct status_change_entry *data[SC_MAX];
+};
+
+#define is_boss(bl) (status_get_mode(bl) & MD_BOSS)
+#define status_get_luk(bl) (status->get_status_data(bl)->luk)
+#define status_get_mode(bl) (status->get_status_data(bl)->mode)
+#define status_get_race(bl) (status->get_status_data(bl)->race)
+#define status_change_end(bl, type, tid) status->change_end_((bl), (type), (tid), __FILE__, __LINE__)
+
+struct status_interface {
+	struct status_data *(*get_status_data)(struct block_list *bl);
+	struct status_change *(*get_sc)(struct block_list *bl);
+	int (*get_class)(const struct block_list *bl);
+	int (*get_lv)(const struct block_list *bl);
+	int (*change_start)(struct block_list *src, struct block_list *bl, enum sc_type type, int rate, int val1, int val2, int val3, int val4, int total_tick, int flag, int skill_id);
+	int (*change_end_)(struct block_list *bl, enum sc_type type, int tid, const char *file, int line);
+	int (*change_clear)(struct block_list *bl, int type);
+	int (*check_skilluse)(struct block_list *src, struct block_list *target, uint16 skill_id, int flag);
+	int (*damage)(struct block_list *src, struct block_list *target, int64 hp, int64 sp, int walkdelay, int flag);
+	int (*heal)(struct block_list *bl, int64 hp, int64 sp, int flag);
+};
+
+extern struct status_interface *status;
+
+#endif /* MAP_STATUS_H */
@@ -0,0 +1,61 @@
+// Stand-in for Hercules' map/unit.h, see bench/README.md.
+#ifndef MAP_UNIT_H
+#define MAP_UNIT_H
+
+#include "map/path.h"
+
+struct unit_data {
+	struct block_list *bl;
+	struct walkpath_data walkpath;
+	int skilltimer;
+	uint16 skill_id, skill_lv;
+	int skilltarget;
+	int attacktimer;
+	int walktimer;
+	int chaserange;
+	int attacktarget_lv;
+	short to_x, to_y;
+	short skillx, skilly;
+	int target; // Walk target
+	int target_to;
+	int64 attackabletime;
+	int64 canact_tick;
+	int64 canmove_tick;
+	uint8 dir;
+	struct {
+		unsigned int change_walk_target : 1;
+		unsigned int skillcastcancel : 1;
+		unsigned int attack_continue : 1;
+		unsigned int walk_easy : 1;
+		unsigned int running : 1;
+		unsigned int speed_changed : 1;
+		unsigned int step_attack : 1;
+	} state;
+	char title[NAME_LENGTH];
+	int32 groupId;
+};
+
+struct view_data {
+	int class;
+	int weapon, shield;
+	int head_top, head_mid, head_bottom;
+	int hair_style, hair_color, cloth_color, body_style;
+	char sex;
+	unsigned dead_sit : 2;
+};
+
+struct unit_interface {
+	struct unit_data *(*bl2ud)(struct block_list *bl);
+	int (*walktoxy)(struct block_list *bl, short x, short y, int flag);
+	int (*walk_tobl)(struct block_list *bl, struct block_list *tbl, int range, int flag);
+	bool (*can_move)(struct block_list *bl);
+	int (*set_walkdelay)(struct block_list *bl, int64 tick, int delay, int type);
+	int (*attack)(struct block_list *src, int target_id, int continuous);
+	int (*attempt_escape)(struct block_list *bl, struct block_list *target, int16 dist);
+	int (*stop_walking)(struct block_list *bl, int type);
+	int (*stop_attack)(struct block_list *bl);
+};
+
+extern struct unit_interface *unit;
+
+#endif /* MAP_UNIT_H */
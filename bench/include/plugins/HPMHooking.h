@@ -0,0 +1,63 @@
+// Stand-in for Hercules' plugins/HPMHooking.h, see bench/README.md.
+// Hooks run as in HPMHooking: every pre-hook, then the original unless a
+// pre-hook called hookStop(), then every post-hook. Only the functions
+// hooked by the plugins of this repo can be hooked.
+#ifndef PLUGINS_HPMHOOKING_H
+#define PLUGINS_HPMHOOKING_H
+
+#include "common/HPMi.h"
+#include "map/homunculus.h"
+#include "map/map.h"
+#include "map/mob.h"
+#include "map/path.h"
+#include "map/status.h"
+
+typedef bool (*HPMHOOK_pre_atcommand_exec)(const int *fd, struct map_session_data **sd, const char **message, bool *player_invoked);
+typedef bool (*HPMHOOK_post_atcommand_exec)(bool retVal, const int fd, struct map_session_data *sd, const char *message, bool player_invoked);
+typedef void (*HPMHOOK_pre_homun_reload)(void);
+typedef void (*HPMHOOK_post_homun_reload)(void);
+typedef bool (*HPMHOOK_pre_homun_levelup)(struct homun_data **hd);
+typedef bool (*HPMHOOK_post_homun_levelup)(bool retVal, struct homun_data *hd);
+typedef bool (*HPMHOOK_pre_homun_evolve)(struct homun_data **hd);
+typedef bool (*HPMHOOK_post_homun_evolve)(bool retVal, struct homun_data *hd);
+typedef bool (*HPMHOOK_pre_homun_delete)(struct homun_data **hd, int *emote);
+typedef bool (*HPMHOOK_post_homun_delete)(bool retVal, struct homun_data *hd, int emote);
+typedef int (*HPMHOOK_pre_status_change_start)(struct block_list **src, struct block_list **bl, enum sc_type *type, int *rate, int *val1, int *val2, int *val3, int *val4, int *total_tick, int *flag, int *skill_id);
+typedef int (*HPMHOOK_post_status_change_start)(int retVal, struct block_list *src, struct block_list *bl, enum sc_type type, int rate, int val1, int val2, int val3, int val4, int total_tick, int flag, int skill_id);
+typedef int (*HPMHOOK_pre_status_change_end_)(struct block_list **bl, enum sc_type *type, int *tid, const char **file, int *line);
+typedef int (*HPMHOOK_post_status_change_end_)(int retVal, struct block_list *bl, enum sc_type type, int tid, const char *file, int line);
+typedef void (*HPMHOOK_pre_map_setcell)(int16 *m, int16 *x, int16 *y, cell_t *cell, bool *flag);
+typedef void (*HPMHOOK_post_map_setcell)(int16 m, int16 x, int16 y, cell_t cell, bool flag);
+typedef void (*HPMHOOK_pre_map_setgatcell)(int16 *m, int16 *x, int16 *y, int *gat);
+typedef void (*HPMHOOK_post_map_setgatcell)(int16 m, int16 x, int16 y, int gat);
+typedef int (*HPMHOOK_pre_map_addblock)(struct block_list **bl);
+typedef int (*HPMHOOK_post_map_addblock)(int retVal, struct block_list *bl);
+typedef int (*HPMHOOK_pre_map_delblock)(struct block_list **bl);
+typedef int (*HPMHOOK_post_map_delblock)(int retVal, struct block_list *bl);
+typedef void (*HPMHOOK_pre_map_deliddb)(struct block_list **bl);
+typedef void (*HPMHOOK_post_map_deliddb)(struct block_list *bl);
+typedef int (*HPMHOOK_pre_mob_ai_hard)(int *tid, int64 *tick, int *id, intptr_t *data);
+typedef int (*HPMHOOK_post_mob_ai_hard)(int retVal, int tid, int64 tick, int id, intptr_t data);
+typedef int (*HPMHOOK_pre_mob_spawn)(struct mob_data **md);
+typedef int (*HPMHOOK_post_mob_spawn)(int retVal, struct mob_data *md);
+typedef void (*HPMHOOK_pre_mob_reload)(void);
+typedef void (*HPMHOOK_post_mob_reload)(void);
+typedef void (*HPMHOOK_pre_mob_damage)(struct mob_data **md, struct block_list **src, int *damage);
+typedef void (*HPMHOOK_post_mob_damage)(struct mob_data *md, struct block_list *src, int damage);
+typedef void (*HPMHOOK_pre_mob_heal)(struct mob_data **md, unsigned int *heal);
+typedef void (*HPMHOOK_post_mob_heal)(struct mob_data *md, unsigned int heal);
+typedef bool (*HPMHOOK_pre_path_search)(struct walkpath_data **wpd, struct block_list **bl, int16 *m, int16 *x0, int16 *y0, int16 *x1, int16 *y1, int *flag, cell_chk *cell);
+typedef bool (*HPMHOOK_post_path_search)(bool retVal, struct walkpath_data *wpd, struct block_list *bl, int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int flag, cell_chk cell);
+
+#define addHookPre(ifname, funcname, hook) ( \
+	(void)((HPMHOOK_pre_ ## ifname ## _ ## funcname)0 == (hook)), \
+	HPMi->AddHook(HOOK_TYPE_PRE, #ifname "->" #funcname, (void *)(hook), HPMi->pid) \
+	)
+#define addHookPost(ifname, funcname, hook) ( \
+	(void)((HPMHOOK_post_ ## ifname ## _ ## funcname)0 == (hook)), \
+	HPMi->AddHook(HOOK_TYPE_POST, #ifname "->" #funcname, (void *)(hook), HPMi->pid) \
+	)
+#define hookStop() (HPMi->HookStop(__func__, HPMi->pid))
+#define hookStopped() (HPMi->HookStopped())
+
+#endif /* PLUGINS_HPMHOOKING_H */
@@ -0,0 +1,24 @@
+//===== Plugin bench =========================================
+//= server.h
+//===== Description: =========================================
+//= What the parts of the stand-in map-server use of each other.
+//= Drivers only need bench.h.
+//============================================================
+#ifndef BENCH_SERVER_H
+#define BENCH_SERVER_H
+
+#include "common/hercules.h"
+
+struct hplugin_data_store;
+struct map_session_data;
+
+// core.c
+void bench_timer_run(int64 tick);
+int bench_session_new(void *session_data);
+
+// hpm.c
+void bench_hpm_init(void);
+void bench_hpm_free_store(struct hplugin_data_store **storeptr);
+bool bench_atcommand_exec(const int fd, struct map_session_data *sd, const char *message, bool player_invoked);
+
+#endif /* BENCH_SERVER_H */
@@ -0,0 +1,2804 @@
+//===== Plugin bench =========================================
+//= world.c
+//===== Description: =========================================
+//= Stand-in for the map-server the plugins hook into: maps and
+//= their blocks, units walking and attacking, the stock mob AI,
+//= mob deaths and respawns, floor items, homunculi and what clif
+//= would send. Also the bench.h API the drivers use.
+//===== Additional Comments: =================================
+//= Each function does what the Hercules function of the same name
+//= does, cut down to what the plugins can observe. Functions are
+//= always called through their interface, so plugin hooks and
+//= replacements see every call the map-server would make.
+//= See bench/README.md.
+//============================================================
+#include "common/hercules.h"
+#include "common/db.h"
+#include "common/memmgr.h"
+#include "common/nullpo.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/strlib.h"
+#include "common/timer.h"
+#include "map/achievement.h"
+#include "map/atcommand.h"
+#include "map/battle.h"
+#include "map/clif.h"
+#include "map/guild.h"
+#include "map/homunculus.h"
+#include "map/itemdb.h"
+#include "map/log.h"
+#include "map/map.h"
+#include "map/mercenary.h"
+#include "map/mob.h"
+#include "map/npc.h"
+#include "map/party.h"
+#include "map/path.h"
+#include "map/pc.h"
+#include "map/pet.h"
+#include "map/quest.h"
+#include "map/script.h"
+#include "map/skill.h"
+#include "map/status.h"
+#include "map/unit.h"
+#include "bench.h"
+#include "server.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// What the plugin exports, see HPExport
+void plugin_init(void);
+void plugin_final(void);
+void server_online(void);
+
+#define START_NPC_NUM 110000000
+#define START_CHAR_NUM 150000
+#define ACTIVE_AI_RANGE 2 // Mobs this far beyond AREA_SIZE of a player still think
+#define MAX_MINCHASE 30
+#define MAX_HOMUN_LEVEL 99
+
+struct bench_counters bench_count;
+
+static int bench_scale_factor = 1;
+static bool bench_echo_on = false;
+
+static int bench_last_id = START_NPC_NUM; // Mobs, homunculi and floor items
+static int bench_last_account = START_ACCOUNT_NUM;
+
+static struct DBMap *id_db = NULL; // id -> struct block_list *
+static struct DBMap *mobid_db = NULL; // id -> struct mob_data *
+static struct DBMap *charid_db = NULL; // char_id -> struct map_session_data *
+static struct map_session_data **bench_pcs = NULL;
+static int bench_pc_count = 0;
+
+static int bench_new_id(void)
+{
+	return ++bench_last_id;
+}
+
+/*==========================================
+ * Blocks
+ *------------------------------------------*/
+static struct block_list bl_head; // prev of the first block of a cell list, as in Hercules
+
+static int block_free_lock = 0;
+static struct block_list **block_free = NULL;
+static int block_free_count = 0, block_free_max = 0;
+
+static struct block_list **bl_list = NULL; // Stack of the foreach* collections in progress
+static int bl_list_count = 0, bl_list_max = 0;
+
+static struct block_list **map_block_head(struct block_list *bl)
+{
+	struct map_data *mp = &map->list[bl->m];
+	int pos = bl->x / BLOCK_SIZE + (bl->y / BLOCK_SIZE) * mp->bxs;
+
+	return bl->type == BL_MOB ? &mp->block_mob[pos] : &mp->block[pos];
+}
+
+static int map_addblock(struct block_list *bl)
+{
+	struct block_list **head;
+
+	nullpo_ret(bl);
+
+	if (bl->prev != NULL) {
+		ShowError("map_addblock: bl->prev != NULL\n");
+		return 1;
+	}
+	if (bl->m < 0 || bl->m >= map->count) {
+		ShowError("map_addblock: invalid map id (%d), only %d are loaded.\n", bl->m, map->count);
+		return 1;
+	}
+	if (bl->x < 0 || bl->x >= map->list[bl->m].xs || bl->y < 0 || bl->y >= map->list[bl->m].ys) {
+		ShowError("map_addblock: out-of-bounds coordinates (\"%s\",%d,%d), map is %dx%d\n", map->list[bl->m].name, bl->x, bl->y, map->list[bl->m].xs, map->list[bl->m].ys);
+		return 1;
+	}
+
+	head = map_block_head(bl);
+	bl->prev = &bl_head;
+	bl->next = *head;
+	if (bl->next != NULL)
+		bl->next->prev = bl;
+	*head = bl;
+
+	if (bl->type == BL_PC)
+		map->list[bl->m].users++;
+	return 0;
+}
+
+static int map_delblock(struct block_list *bl)
+{
+	nullpo_ret(bl);
+
+	if (bl->prev == NULL) {
+		if (bl->next != NULL)
+			ShowError("map_delblock error : bl->next != NULL\n");
+		return 0;
+	}
+
+	if (bl->type == BL_PC)
+		map->list[bl->m].users--;
+
+	if (bl->next != NULL)
+		bl->next->prev = bl->prev;
+	if (bl->prev == &bl_head)
+		*map_block_head(bl) = bl->next;
+	else
+		bl->prev->next = bl->next;
+	bl->next = NULL;
+	bl->prev = NULL;
+	return 0;
+}
+
+static int map_moveblock(struct block_list *bl, int x1, int y1, int64 tick)
+{
+	int x0 = bl->x, y0 = bl->y;
+	bool moveblock = (x0 / BLOCK_SIZE != x1 / BLOCK_SIZE || y0 / BLOCK_SIZE != y1 / BLOCK_SIZE);
+
+	if (bl->prev == NULL)
+		return 0; // Not on a map
+
+	if (moveblock)
+		map->delblock(bl);
+	bl->x = x1;
+	bl->y = y1;
+	if (moveblock && map->addblock(bl) != 0)
+		return 1;
+	return 0;
+}
+
+static int map_freeblock_lock(void)
+{
+	return ++block_free_lock;
+}
+
+static int map_freeblock_unlock(void)
+{
+	if (--block_free_lock == 0) {
+		int i;
+
+		for (i = 0; i < block_free_count; i++)
+			aFree(block_free[i]);
+		block_free_count = 0;
+	} else if (block_free_lock < 0) {
+		ShowError("map_freeblock_unlock: lock count < 0 !\n");
+		block_free_lock = 0;
+	}
+	return block_free_lock;
+}
+
+// Frees bl now, or once the last map->freeblock_unlock() runs
+static void map_freeblock(struct block_list *bl)
+{
+	if (block_free_lock == 0) {
+		aFree(bl);
+		return;
+	}
+	if (block_free_count == block_free_max) {
+		block_free_max = max(block_free_max * 2, 64);
+		RECREATE(block_free, struct block_list *, block_free_max);
+	}
+	block_free[block_free_count++] = bl;
+}
+
+static void map_addiddb(struct block_list *bl)
+{
+	nullpo_retv(bl);
+
+	idb_put(id_db, bl->id, bl);
+	if (bl->type == BL_PC)
+		idb_put(charid_db, BL_UCAST(BL_PC, bl)->status.char_id, bl);
+	else if (bl->type == BL_MOB)
+		idb_put(mobid_db, bl->id, bl);
+}
+
+static void map_deliddb(struct block_list *bl)
+{
+	nullpo_retv(bl);
+
+	idb_remove(id_db, bl->id);
+	if (bl->type == BL_PC)
+		idb_remove(charid_db, BL_UCAST(BL_PC, bl)->status.char_id);
+	else if (bl->type == BL_MOB)
+		idb_remove(mobid_db, bl->id);
+}
+
+static struct block_list *map_id2bl(int id)
+{
+	return idb_get(id_db, id);
+}
+
+static struct mob_data *map_id2md(int id)
+{
+	struct block_list *bl = map->id2bl(id);
+
+	return BL_CAST(BL_MOB, bl);
+}
+
+static struct map_session_data *map_id2sd(int id)
+{
+	struct block_list *bl = map->id2bl(id);
+
+	return BL_CAST(BL_PC, bl);
+}
+
+static struct map_session_data *map_charid2sd(int charid)
+{
+	return idb_get(charid_db, charid);
+}
+
+/*==========================================
+ * Area searches: a square area, as Hercules without CIRCULAR_AREA
+ *------------------------------------------*/
+static void bl_list_push(struct block_list *bl)
+{
+	if (bl_list_count == bl_list_max) {
+		bl_list_max = max(bl_list_max * 2, 256);
+		RECREATE(bl_list, struct block_list *, bl_list_max);
+	}
+	bl_list[bl_list_count++] = bl;
+}
+
+static int map_vforeachinarea(int (*func)(struct block_list *, va_list), int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int type, va_list ap)
+{
+	struct map_data *mp;
+	int bx, by, i, start, end, returnCount = 0;
+
+	if (m < 0 || m >= map->count)
+		return 0;
+	mp = &map->list[m];
+	if (x0 > x1)
+		swap(x0, x1);
+	if (y0 > y1)
+		swap(y0, y1);
+	x0 = max(x0, 0);
+	y0 = max(y0, 0);
+	x1 = min(x1, mp->xs - 1);
+	y1 = min(y1, mp->ys - 1);
+
+	start = bl_list_count;
+	for (by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++) {
+		for (bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++) {
+			struct block_list *bl;
+
+			if (type&~BL_MOB) {
+				for (bl = mp->block[bx + by * mp->bxs]; bl != NULL; bl = bl->next) {
+					if ((bl->type&type) && bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1)
+						bl_list_push(bl);
+				}
+			}
+			if (type&BL_MOB) {
+				for (bl = mp->block_mob[bx + by * mp->bxs]; bl != NULL; bl = bl->next) {
+					if (bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1)
+						bl_list_push(bl);
+				}
+			}
+		}
+	}
+	end = bl_list_count;
+
+	map->freeblock_lock();
+	for (i = start; i < end; i++) {
+		if (bl_list[i]->prev != NULL) { // Still on the map
+			va_list args;
+
+			va_copy(args, ap);
+			returnCount += func(bl_list[i], args);
+			va_end(args);
+		}
+	}
+	map->freeblock_unlock();
+
+	bl_list_count = start;
+	return returnCount;
+}
+
+static int map_foreachinrange(int (*func)(struct block_list *, va_list), struct block_list *center, int16 range, int type, ...)
+{
+	va_list ap;
+	int returnCount;
+
+	nullpo_ret(center);
+
+	va_start(ap, type);
+	returnCount = map_vforeachinarea(func, center->m, center->x - range, center->y - range, center->x + range, center->y + range, type, ap);
+	va_end(ap);
+	return returnCount;
+}
+
+static int map_foreachinarea(int (*func)(struct block_list *, va_list), int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int type, ...)
+{
+	va_list ap;
+	int returnCount;
+
+	va_start(ap, type);
+	returnCount = map_vforeachinarea(func, m, x0, y0, x1, y1, type, ap);
+	va_end(ap);
+	return returnCount;
+}
+
+static int map_foreachpc(int (*func)(struct map_session_data *sd, va_list args), ...)
+{
+	int i, ret = 0;
+
+	for (i = 0; i < bench_pc_count; i++) {
+		va_list args;
+
+		va_start(args, func);
+		ret += func(bench_pcs[i], args);
+		va_end(args);
+	}
+	return ret;
+}
+
+static int map_foreachmob(int (*func)(struct mob_data *md, va_list args), ...)
+{
+	struct DBIterator *iter = db_iterator(mobid_db);
+	struct mob_data *md;
+	int ret = 0;
+
+	for (md = dbi_first(iter); dbi_exists(iter); md = dbi_next(iter)) {
+		va_list args;
+
+		va_start(args, func);
+		ret += func(md, args);
+		va_end(args);
+	}
+	dbi_destroy(iter);
+	return ret;
+}
+
+/*==========================================
+ * Cells: one byte per cell, non-zero for a wall
+ *------------------------------------------*/
+static int map_getcell(int16 m, const struct block_list *bl, int16 x, int16 y, cell_chk cellchk)
+{
+	const struct map_data *mp;
+	bool wall;
+
+	if (m < 0 || m >= map->count || x < 0 || x >= map->list[m].xs || y < 0 || y >= map->list[m].ys)
+		return (cellchk == CELL_CHKNOPASS || cellchk == CELL_CHKNOREACH || cellchk == CELL_CHKWALL) ? 1 : 0;
+	mp = &map->list[m];
+	wall = (mp->cell[x + y * mp->xs] != 0);
+
+	switch (cellchk) {
+	case CELL_GETTYPE:
+		return wall ? 1 : 0;
+	case CELL_CHKWALL:
+	case CELL_CHKNOPASS:
+	case CELL_CHKNOREACH:
+		return wall ? 1 : 0;
+	case CELL_CHKPASS:
+	case CELL_CHKREACH:
+		return wall ? 0 : 1;
+	default:
+		return 0;
+	}
+}
+
+static void map_setcell(int16 m, int16 x, int16 y, cell_t cell, bool flag)
+{
+	struct map_data *mp;
+
+	if (m < 0 || m >= map->count || x < 0 || x >= map->list[m].xs || y < 0 || y >= map->list[m].ys)
+		return;
+	mp = &map->list[m];
+	if (cell == CELL_WALKABLE)
+		mp->cell[x + y * mp->xs] = flag ? 0 : 1;
+}
+
+static void map_setgatcell(int16 m, int16 x, int16 y, int gat)
+{
+	struct map_data *mp;
+
+	if (m < 0 || m >= map->count || x < 0 || x >= map->list[m].xs || y < 0 || y >= map->list[m].ys)
+		return;
+	mp = &map->list[m];
+	mp->cell[x + y * mp->xs] = (gat == 1 || gat == 5) ? 1 : 0;
+}
+
+static int map_race_id2mask(int race)
+{
+	if (race >= RC_FORMLESS && race < RC_MAX)
+		return 1 << race;
+	return RCMASK_NONE;
+}
+
+/*==========================================
+ * clif: nothing is built or sent, packets are counted per connection
+ *------------------------------------------*/
+static void clif_count(int fd, int len)
+{
+	bench_count.packets++;
+	bench_count.bytes += len;
+	if (sockt->session_is_valid(fd)) {
+		sockt->session[fd]->packets_sent++;
+		sockt->session[fd]->bytes_sent += len;
+	}
+}
+
+static int clif_count_area_sub(struct block_list *bl, va_list ap)
+{
+	int len = va_arg(ap, int);
+
+	clif_count(BL_UCAST(BL_PC, bl)->fd, len);
+	return 1;
+}
+
+// clif->send to AREA: once per player around bl
+static void clif_count_area(struct block_list *bl, int len)
+{
+	map->foreachinrange(clif_count_area_sub, bl, AREA_SIZE, BL_PC, len);
+}
+
+static void clif_message(const int fd, const char *mes)
+{
+	nullpo_retv(mes);
+
+	bench_count.messages++;
+	clif_count(fd, (int)strlen(mes) + 5); // ZC_NOTIFY_PLAYERCHAT
+	if (bench_echo_on)
+		printf("  | %s\n", mes);
+}
+
+static void clif_send_selforarea(int fd, struct block_list *bl, const void *buf, int len)
+{
+	if (fd == 0)
+		clif_count_area(bl, len);
+	else
+		clif_count(fd, len);
+}
+
+static void clif_mobname_normal_ack(int fd, struct block_list *bl)
+{
+	struct PACKET_ZC_ACK_REQNAME_TITLE packet = { 0 };
+	const struct mob_data *md;
+
+	nullpo_retv(bl);
+	Assert_retv(bl->type == BL_MOB);
+	md = BL_UCCAST(BL_MOB, bl);
+
+	packet.packet_id = HEADER_ZC_ACK_REQNAME_TITLE;
+	packet.gid = bl->id;
+	memcpy(packet.name, md->name, NAME_LENGTH);
+#if PACKETVER_MAIN_NUM >= 20180207 || PACKETVER_RE_NUM >= 20171129 || PACKETVER_ZERO_NUM >= 20171130
+	packet.groupId = md->ud.groupId;
+	memcpy(packet.title, md->ud.title, NAME_LENGTH);
+#endif
+	clif->send_selforarea(fd, bl, &packet, sizeof(packet));
+}
+
+static void clif_additem(struct map_session_data *sd, int n, int amount, int fail)
+{
+	clif_count(sd->fd, 29); // ZC_ITEM_PICKUP_ACK
+}
+
+static void clif_takeitem(struct block_list *src, struct block_list *dst)
+{
+	clif_count_area(src, 7); // ZC_ITEM_PICKUP
+}
+
+static void clif_clearunit_area(struct block_list *bl, enum clr_type type)
+{
+	clif_count_area(bl, 7); // ZC_NOTIFY_VANISH
+}
+
+static void clif_clearunit_delayed(struct block_list *bl, enum clr_type type, int64 tick)
+{
+	clif_count_area(bl, 7);
+}
+
+static int clif_item_drop_announce_sub(struct map_session_data *sd, va_list ap)
+{
+	clif_count(sd->fd, 31); // ZC_ITEM_DROP_ANNOUNCE
+	return 1;
+}
+
+static void clif_item_drop_announce(struct map_session_data *sd, int nameid, char *monsterName)
+{
+	map->foreachpc(clif_item_drop_announce_sub);
+}
+
+static void clif_mission_info(struct map_session_data *sd, int mob_id, unsigned char progress)
+{
+	clif_count(sd->fd, 8);
+}
+
+static void clif_mvp_effect(struct map_session_data *sd)
+{
+	clif_count_area(&sd->bl, 6);
+}
+
+static void clif_mvp_exp(struct map_session_data *sd, unsigned int exp)
+{
+	clif_count(sd->fd, 6);
+}
+
+static void clif_mvp_item(struct map_session_data *sd, int nameid)
+{
+	clif_count(sd->fd, 4);
+}
+
+/*==========================================
+ * Floor items
+ *------------------------------------------*/
+static int map_clearflooritem_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	struct block_list *bl = map->id2bl(id);
+	struct flooritem_data *fitem = BL_CAST(BL_ITEM, bl);
+
+	if (fitem == NULL || fitem->cleartimer != tid) {
+		ShowError("map_clearflooritem_timer : error\n");
+		return 1;
+	}
+
+	clif_count_area(&fitem->bl, 6); // ZC_ITEM_DISAPPEAR
+	map->deliddb(&fitem->bl);
+	map->delblock(&fitem->bl);
+	map_freeblock(&fitem->bl);
+	return 0;
+}
+
+static void map_clearflooritem(struct block_list *bl)
+{
+	struct flooritem_data *fitem = BL_CAST(BL_ITEM, bl);
+
+	nullpo_retv(fitem);
+
+	if (fitem->cleartimer != INVALID_TIMER)
+		timer->delete(fitem->cleartimer, map->clearflooritem_timer);
+
+	bench_count.pickups++;
+	clif_count_area(&fitem->bl, 6);
+	map->deliddb(&fitem->bl);
+	map->delblock(&fitem->bl);
+	map_freeblock(&fitem->bl);
+}
+
+static int map_addflooritem(const struct block_list *bl, struct item *item_data, int amount, int16 m, int16 x, int16 y, int first_charid, int second_charid, int third_charid, int flags, bool showdropeffect)
+{
+	struct flooritem_data *fitem;
+	int64 tick = timer->gettick();
+
+	nullpo_ret(item_data);
+
+	if (m < 0 || m >= map->count || map->getcell(m, bl, x, y, CELL_CHKNOPASS))
+		return 0;
+
+	CREATE(fitem, struct flooritem_data, 1);
+	fitem->bl.type = BL_ITEM;
+	fitem->bl.id = bench_new_id();
+	fitem->bl.m = m;
+	fitem->bl.x = x;
+	fitem->bl.y = y;
+	memcpy(&fitem->item_data, item_data, sizeof(*item_data));
+	fitem->item_data.amount = amount;
+	fitem->subx = (rnd() & 3) * 3 + 3;
+	fitem->suby = (rnd() & 3) * 3 + 3;
+	fitem->first_get_charid = first_charid;
+	fitem->first_get_tick = tick + 3000;
+	fitem->second_get_charid = second_charid;
+	fitem->second_get_tick = tick + 4500;
+	fitem->third_get_charid = third_charid;
+	fitem->third_get_tick = tick + 6000;
+	fitem->cleartimer = timer->add(tick + 60000, map->clearflooritem_timer, fitem->bl.id, 0);
+
+	map->addiddb(&fitem->bl);
+	if (map->addblock(&fitem->bl) != 0)
+		return 0;
+	bench_count.flooritems++;
+	clif_count_area(&fitem->bl, 19); // ZC_ITEM_FALL_ENTRY
+	return fitem->bl.id;
+}
+
+/*==========================================
+ * Paths: straight towards the target, sliding along walls
+ *------------------------------------------*/
+static const int8 dirx[UNIT_DIR_MAX] = { 0, -1, -1, -1, 0, 1, 1, 1 };
+static const int8 diry[UNIT_DIR_MAX] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+
+static enum directions path_dir(int dx, int dy)
+{
+	enum directions dir;
+
+	for (dir = UNIT_DIR_NORTH; dir < UNIT_DIR_MAX; dir++) {
+		if (dirx[dir] == dx && diry[dir] == dy)
+			break;
+	}
+	return dir;
+}
+
+// flag&1: "easy" walk, no sliding along walls
+static bool path_search(struct walkpath_data *wpd, struct block_list *bl, int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int flag, cell_chk cell)
+{
+	struct walkpath_data tmp;
+	int x = x0, y = y0;
+
+	bench_count.path_searches++;
+	if (wpd == NULL)
+		wpd = &tmp;
+	wpd->path_len = 0;
+	wpd->path_pos = 0;
+
+	if (m < 0 || m >= map->count || map->getcell(m, bl, x1, y1, cell))
+		return false;
+
+	while (x != x1 || y != y1) {
+		int dx = (x1 > x) - (x1 < x), dy = (y1 > y) - (y1 < y);
+
+		if (wpd->path_len == MAX_WALKPATH)
+			return false;
+		if (dx != 0 && dy != 0 && !map->getcell(m, bl, x + dx, y + dy, cell)
+		 && !map->getcell(m, bl, x + dx, y, cell) && !map->getcell(m, bl, x, y + dy, cell)) {
+			; // Diagonal step, no cutting corners
+		} else if (flag&1) {
+			if (dx != 0 && dy != 0)
+				return false;
+			if (map->getcell(m, bl, x + dx, y + dy, cell))
+				return false;
+		} else if (dx != 0 && !map->getcell(m, bl, x + dx, y, cell)) {
+			dy = 0;
+		} else if (dy != 0 && !map->getcell(m, bl, x, y + dy, cell)) {
+			dx = 0;
+		} else {
+			return false;
+		}
+		x += dx;
+		y += dy;
+		wpd->path[wpd->path_len++] = path_dir(dx, dy);
+	}
+	return true;
+}
+
+// Line of sight from (x0, y0) to (x1, y1)
+static bool path_search_long(struct shootpath_data *spd, struct block_list *bl, int16 m, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cell)
+{
+	int dx = abs(x1 - x0), dy = -abs(y1 - y0);
+	int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+	int err = dx + dy, x = x0, y = y0;
+
+	if (spd != NULL) {
+		spd->rx = spd->ry = 0;
+		spd->len = 0;
+	}
+	for (;;) {
+		if (spd != NULL && spd->len < MAX_WALKPATH) {
+			spd->x[spd->len] = x;
+			spd->y[spd->len] = y;
+			spd->len++;
+		}
+		if (map->getcell(m, bl, x, y, cell))
+			return false;
+		if (x == x1 && y == y1)
+			return true;
+		if (2 * err >= dy) {
+			err += dy;
+			x += sx;
+		}
+		if (2 * err <= dx) {
+			err += dx;
+			y += sy;
+		}
+	}
+}
+
+static bool path_check_distance(int dx, int dy, int distance)
+{
+	dx = abs(dx);
+	dy = abs(dy);
+	return (dx < dy ? dy : dx) <= distance;
+}
+
+static unsigned int path_distance(int dx, int dy)
+{
+	dx = abs(dx);
+	dy = abs(dy);
+	return dx < dy ? dy : dx;
+}
+
+/*==========================================
+ * Units
+ *------------------------------------------*/
+static struct unit_data *unit_bl2ud(struct block_list *bl)
+{
+	if (bl == NULL)
+		return NULL;
+	switch (bl->type) {
+	case BL_PC: return &BL_UCAST(BL_PC, bl)->ud;
+	case BL_MOB: return &BL_UCAST(BL_MOB, bl)->ud;
+	case BL_HOM: return &BL_UCAST(BL_HOM, bl)->ud;
+	default: return NULL;
+	}
+}
+
+static void unit_dataset(struct block_list *bl, struct unit_data *ud)
+{
+	memset(ud, 0, sizeof(*ud));
+	ud->bl = bl;
+	ud->walktimer = INVALID_TIMER;
+	ud->skilltimer = INVALID_TIMER;
+	ud->attacktimer = INVALID_TIMER;
+	ud->attackabletime = ud->canact_tick = ud->canmove_tick = timer->gettick();
+}
+
+static int unit_step_time(struct block_list *bl, enum directions dir)
+{
+	int speed = status->get_status_data(bl)->speed;
+
+	return (dir&1) ? speed * 14 / 10 : speed;
+}
+
+static int unit_walktoxy_timer(int tid, int64 tick, int id, intptr_t data);
+
+// Paths to ud->to_x, ud->to_y and starts walking. false when there is no path.
+static bool unit_walktoxy_sub(struct block_list *bl)
+{
+	struct unit_data *ud = unit->bl2ud(bl);
+	struct walkpath_data wpd;
+
+	if (!path->search(&wpd, bl, bl->m, bl->x, bl->y, ud->to_x, ud->to_y, ud->state.walk_easy, CELL_CHKNOREACH))
+		return false;
+	memcpy(&ud->walkpath, &wpd, sizeof(wpd));
+	ud->state.change_walk_target = 0;
+	if (ud->walkpath.path_len == 0)
+		return true;
+	ud->walktimer = timer->add(timer->gettick() + unit_step_time(bl, ud->walkpath.path[0]), unit_walktoxy_timer, bl->id, 0);
+	return true;
+}
+
+// Gives up on the unit it walked to
+static void unit_walk_end(struct block_list *bl, struct unit_data *ud)
+{
+	ud->walkpath.path_len = 0;
+	ud->state.change_walk_target = 0;
+	if (ud->target_to != 0 && ud->target == ud->target_to && ud->attacktimer == INVALID_TIMER)
+		ud->target = 0;
+	ud->target_to = 0;
+}
+
+static int unit_walktoxy_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	struct block_list *bl = map->id2bl(id), *tbl;
+	struct unit_data *ud = unit->bl2ud(bl);
+	enum directions dir;
+	int x, y;
+
+	if (ud == NULL)
+		return 0;
+	if (ud->walktimer != tid) {
+		ShowError("unit_walk_timer mismatch %d != %d\n", ud->walktimer, tid);
+		return 0;
+	}
+	ud->walktimer = INVALID_TIMER;
+	if (bl->prev == NULL || ud->walkpath.path_pos >= ud->walkpath.path_len)
+		return 0;
+
+	dir = ud->walkpath.path[ud->walkpath.path_pos];
+	x = bl->x + dirx[dir];
+	y = bl->y + diry[dir];
+	if (map->getcell(bl->m, bl, x, y, CELL_CHKNOPASS)) {
+		// The map changed under the path
+		unit_walk_end(bl, ud);
+		if (bl->type == BL_MOB)
+			BL_UCAST(BL_MOB, bl)->walktoxy_fail_count++;
+		return 0;
+	}
+	ud->dir = dir;
+	map->moveblock(bl, x, y, tick);
+	ud->walkpath.path_pos++;
+
+	tbl = ud->target_to != 0 ? map->id2bl(ud->target_to) : NULL;
+	if (tbl != NULL && (tbl->prev == NULL || tbl->m != bl->m))
+		tbl = NULL; // Died or left
+	if (tbl != NULL && check_distance_bl(bl, tbl, ud->chaserange)) {
+		// Reached the unit it walks to
+		ud->walkpath.path_len = 0;
+		ud->to_x = bl->x;
+		ud->to_y = bl->y;
+		if (ud->state.attack_continue)
+			unit->attack(bl, tbl->id, 1);
+		return 0;
+	}
+	if (ud->state.change_walk_target) {
+		if (tbl != NULL) {
+			ud->to_x = tbl->x;
+			ud->to_y = tbl->y;
+		}
+		if (!unit_walktoxy_sub(bl))
+			unit_walk_end(bl, ud);
+		return 0;
+	}
+	if (ud->walkpath.path_pos < ud->walkpath.path_len) {
+		ud->walktimer = timer->add(tick + unit_step_time(bl, ud->walkpath.path[ud->walkpath.path_pos]), unit_walktoxy_timer, id, 0);
+		return 0;
+	}
+	if (tbl != NULL && ud->state.attack_continue) {
+		// The target moved on, follow it
+		if (unit->walk_tobl(bl, tbl, ud->chaserange, 2|ud->state.walk_easy) != 0)
+			unit_walk_end(bl, ud);
+		return 0;
+	}
+	unit_walk_end(bl, ud);
+	if (bl->type == BL_MOB)
+		BL_UCAST(BL_MOB, bl)->walktoxy_fail_count = 0;
+	return 0;
+}
+
+static bool unit_can_move(struct block_list *bl)
+{
+	struct unit_data *ud = unit->bl2ud(bl);
+	struct status_change *sc = status->get_sc(bl);
+
+	if (ud == NULL || bl->prev == NULL)
+		return false;
+	if (DIFF_TICK(ud->canmove_tick, timer->gettick()) > 0)
+		return false;
+	if (sc != NULL && sc->opt1 != 0)
+		return false;
+	return true;
+}
+
+// 0 when it walks
+static int unit_walktoxy(struct block_list *bl, short x, short y, int flag)
+{
+	struct unit_data *ud = unit->bl2ud(bl);
+
+	if (ud == NULL)
+		return 1;
+	if ((flag&8) && map->getcell(bl->m, bl, x, y, CELL_CHKNOREACH))
+		return 1;
+	if (!unit->can_move(bl))
+		return 1;
+
+	ud->state.walk_easy = flag&1;
+	ud->to_x = x;
+	ud->to_y = y;
+	ud->target_to = 0;
+	unit->stop_attack(bl);
+
+	if (ud->walktimer != INVALID_TIMER) {
+		ud->state.change_walk_target = 1;
+		return 0;
+	}
+	return unit_walktoxy_sub(bl) ? 0 : 1;
+}
+
+// 0 when it walks (or is in range already)
+static int unit_walktobl(struct block_list *bl, struct block_list *tbl, int range, int flag)
+{
+	struct unit_data *ud = unit->bl2ud(bl);
+
+	if (ud == NULL || tbl == NULL || bl->m != tbl->m)
+		return 1;
+	if (!unit->can_move(bl))
+		return 1;
+
+	ud->state.walk_easy = flag&1;
+	ud->target_to = tbl->id;
+	ud->chaserange = range;
+	ud->state.attack_continue = (flag&2) ? 1 : 0;
+
+	if (check_distance_bl(bl, tbl, range)) {
+		if (ud->state.attack_continue)
+			unit->attack(bl, tbl->id, 1);
+		return 0;
+	}
+	ud->to_x = tbl->x;
+	ud->to_y = tbl->y;
+	if (ud->walktimer != INVALID_TIMER) {
+		ud->state.change_walk_target = 1;
+		return 0;
+	}
+	return unit_walktoxy_sub(bl) ? 0 : 1;
+}
+
+static int unit_stop_walking(struct block_list *bl, int type)
+{
+	struct unit_data *ud = unit->bl2ud(bl);
+
+	if (ud == NULL || ud->walktimer == INVALID_TIMER)
+		return 0;
+	timer->delete(ud->walktimer, unit_walktoxy_timer);
+	ud->walktimer = INVALID_TIMER;
+	ud->walkpath.path_len = 0;
+	ud->walkpath.path_pos = 0;
+	ud->to_x = bl->x;
+	ud->to_y = bl->y;
+	ud->state.change_walk_target = 0;
+	return 1;
+}
+
+static int unit_set_walkdelay(struct block_list *bl, int64 tick, int delay, int type)
+{
+	struct unit_data *ud = unit->bl2ud(bl);
+
+	if (ud == NULL || delay <= 0)
+		return 0;
+	if (DIFF_TICK(ud->canmove_tick, tick + delay) < 0)
+		ud->canmove_tick = tick + delay;
+	if (ud->walktimer != INVALID_TIMER)
+		unit->stop_walking(bl, 2);
+	return 1;
+}
+
+static int unit_attack_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	struct block_list *src = map->id2bl(id), *target;
+	struct unit_data *ud = unit->bl2ud(src);
+	struct status_data *sstatus;
+
+	if (ud == NULL || ud->attacktimer != tid)
+		return 0;
+	ud->attacktimer = INVALID_TIMER;
+
+	target = map->id2bl(ud->target);
+	if (target == NULL || src->prev == NULL || target->m != src->m || !status->check_skilluse(src, target, 0, 0)) {
+		if (src->type == BL_MOB)
+			mob->unlocktarget(BL_UCAST(BL_MOB, src), tick);
+		ud->target = 0;
+		return 0;
+	}
+
+	sstatus = status->get_status_data(src);
+	if (!battle->check_range(src, target, sstatus->rhw.range)) {
+		// Chase, and attack again on arrival
+		if (ud->state.attack_continue && unit->walk_tobl(src, target, sstatus->rhw.range, 2) == 0)
+			return 0;
+		ud->target = 0;
+		return 0;
+	}
+	if (ud->walktimer != INVALID_TIMER)
+		unit->stop_walking(src, 1);
+
+	ud->attackabletime = tick + sstatus->adelay;
+	map->freeblock_lock();
+	status->damage(src, target, max(sstatus->batk + sstatus->rhw.atk, 1), 0, 0, 0);
+	if (ud->state.attack_continue && src->prev != NULL)
+		ud->attacktimer = timer->add(ud->attackabletime, unit_attack_timer, id, 0);
+	map->freeblock_unlock();
+	return 0;
+}
+
+// 0 when the attack starts
+static int unit_attack(struct block_list *src, int target_id, int continuous)
+{
+	struct unit_data *ud = unit->bl2ud(src);
+	struct block_list *target = map->id2bl(target_id);
+
+	if (ud == NULL)
+		return 1;
+	if (target == NULL || target->prev == NULL || !status->check_skilluse(src, target, 0, 0)) {
+		unit->stop_attack(src);
+		return 1;
+	}
+
+	ud->target = target_id;
+	ud->state.attack_continue = continuous ? 1 : 0;
+	if (src->type == BL_MOB) {
+		struct mob_data *md = BL_UCAST(BL_MOB, src);
+
+		md->state.skillstate = md->state.aggressive ? MSS_ANGRY : MSS_BERSERK;
+	}
+	if (ud->attacktimer != INVALID_TIMER)
+		return 0;
+	ud->attacktimer = timer->add(max(timer->gettick(), ud->attackabletime), unit_attack_timer, src->id, 0);
+	return 0;
+}
+
+static int unit_stop_attack(struct block_list *bl)
+{
+	struct unit_data *ud = unit->bl2ud(bl);
+
+	if (ud == NULL || ud->attacktimer == INVALID_TIMER)
+		return 0;
+	timer->delete(ud->attacktimer, unit_attack_timer);
+	ud->attacktimer = INVALID_TIMER;
+	ud->target = 0;
+	return 0;
+}
+
+// Walks up to dist cells away from target, 0 when it walks
+static int unit_attempt_escape(struct block_list *bl, struct block_list *target, int16 dist)
+{
+	int dx, dy;
+	enum directions dir;
+
+	nullpo_retr(1, bl);
+	nullpo_retr(1, target);
+
+	dx = (bl->x > target->x) - (bl->x < target->x);
+	dy = (bl->y > target->y) - (bl->y < target->y);
+	if (dx == 0 && dy == 0)
+		dx = 1;
+	dir = path_dir(dx, dy);
+	while (dist > 0 && map->getcell(bl->m, bl, bl->x + dist * dirx[dir], bl->y + dist * diry[dir], CELL_CHKNOREACH))
+		dist--;
+	if (dist <= 0)
+		return 1;
+	return unit->walktoxy(bl, bl->x + dist * dirx[dir], bl->y + dist * diry[dir], 0);
+}
+
+/*==========================================
+ * Status
+ *------------------------------------------*/
+static struct status_data *status_get_status_data(struct block_list *bl)
+{
+	static struct status_data dummy_status;
+
+	if (bl != NULL) {
+		switch (bl->type) {
+		case BL_PC: return &BL_UCAST(BL_PC, bl)->battle_status;
+		case BL_MOB: return &BL_UCAST(BL_MOB, bl)->status;
+		case BL_HOM: return &BL_UCAST(BL_HOM, bl)->battle_status;
+		default: break;
+		}
+	}
+	return &dummy_status;
+}
+
+static struct status_change *status_get_sc(struct block_list *bl)
+{
+	if (bl != NULL) {
+		switch (bl->type) {
+		case BL_PC: return &BL_UCAST(BL_PC, bl)->sc;
+		case BL_MOB: return &BL_UCAST(BL_MOB, bl)->sc;
+		case BL_HOM: return &BL_UCAST(BL_HOM, bl)->sc;
+		default: break;
+		}
+	}
+	return NULL;
+}
+
+static int status_get_class(const struct block_list *bl)
+{
+	nullpo_ret(bl);
+	switch (bl->type) {
+	case BL_PC: return BL_UCCAST(BL_PC, bl)->status.class;
+	case BL_MOB: return BL_UCCAST(BL_MOB, bl)->vd->class;
+	case BL_HOM: return BL_UCCAST(BL_HOM, bl)->homunculus.class_;
+	default: return 0;
+	}
+}
+
+static int status_get_lv(const struct block_list *bl)
+{
+	nullpo_ret(bl);
+	switch (bl->type) {
+	case BL_PC: return BL_UCCAST(BL_PC, bl)->status.base_level;
+	case BL_MOB: return BL_UCCAST(BL_MOB, bl)->level;
+	case BL_HOM: return BL_UCCAST(BL_HOM, bl)->homunculus.level;
+	default: return 1;
+	}
+}
+
+static short status_sc2opt1(enum sc_type type)
+{
+	switch (type) {
+	case SC_STONE: return OPT1_STONE;
+	case SC_FREEZE: return OPT1_FREEZE;
+	case SC_STUN: return OPT1_STUN;
+	case SC_SLEEP: return OPT1_SLEEP;
+	default: return 0;
+	}
+}
+
+static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	struct block_list *bl = map->id2bl(id);
+
+	if (bl != NULL)
+		status_change_end(bl, (enum sc_type)data, tid);
+	return 0;
+}
+
+static int status_change_start(struct block_list *src, struct block_list *bl, enum sc_type type, int rate, int val1, int val2, int val3, int val4, int total_tick, int flag, int skill_id)
+{
+	struct status_change *sc = status->get_sc(bl);
+	struct status_change_entry *sce;
+	short opt1;
+
+	if (sc == NULL || type <= SC_NONE || type >= SC_MAX || status->get_status_data(bl)->hp == 0)
+		return 0;
+
+	if ((sce = sc->data[type]) != NULL) {
+		if (sce->timer != INVALID_TIMER)
+			timer->delete(sce->timer, status_change_timer);
+	} else {
+		CREATE(sce, struct status_change_entry, 1);
+		sc->data[type] = sce;
+		sc->count++;
+	}
+	sce->val1 = val1;
+	sce->val2 = val2;
+	sce->val3 = val3;
+	sce->val4 = val4;
+	sce->total_tick = total_tick;
+	sce->timer = timer->add(timer->gettick() + max(total_tick, 1), status_change_timer, bl->id, type);
+
+	if ((opt1 = status_sc2opt1(type)) != 0) {
+		sc->opt1 = opt1;
+		unit->stop_walking(bl, 1);
+		unit->stop_attack(bl);
+	}
+	return 1;
+}
+
+static int status_change_end_(struct block_list *bl, enum sc_type type, int tid, const char *file, int line)
+{
+	struct status_change *sc = status->get_sc(bl);
+	struct status_change_entry *sce;
+
+	if (sc == NULL || type <= SC_NONE || type >= SC_MAX || (sce = sc->data[type]) == NULL)
+		return 0;
+	if (tid != INVALID_TIMER && sce->timer != tid)
+		return 0;
+	if (tid == INVALID_TIMER && sce->timer != INVALID_TIMER)
+		timer->delete(sce->timer, status_change_timer);
+
+	sc->data[type] = NULL;
+	sc->count--;
+	if (status_sc2opt1(type) != 0 && sc->opt1 == status_sc2opt1(type))
+		sc->opt1 = 0;
+	aFree(sce);
+	return 1;
+}
+
+static int status_change_clear(struct block_list *bl, int type)
+{
+	struct status_change *sc = status->get_sc(bl);
+	int i;
+
+	if (sc == NULL || sc->count == 0)
+		return 0;
+	for (i = 0; i < SC_MAX; i++) {
+		if (sc->data[i] != NULL)
+			status_change_end(bl, (enum sc_type)i, INVALID_TIMER);
+	}
+	sc->opt1 = 0;
+	return 1;
+}
+
+static int status_check_skilluse(struct block_list *src, struct block_list *target, uint16 skill_id, int flag)
+{
+	if (src != NULL) {
+		struct status_change *sc = status->get_sc(src);
+
+		if (src->prev == NULL || status->get_status_data(src)->hp == 0)
+			return 0;
+		if (sc != NULL && sc->opt1 != 0)
+			return 0;
+	}
+	if (target == NULL)
+		return 1;
+	if (target->prev == NULL)
+		return 0;
+	switch (target->type) {
+	case BL_PC: {
+		const struct map_session_data *sd = BL_UCCAST(BL_PC, target);
+
+		if (pc_isdead(sd))
+			return 0;
+		if ((sd->sc.option&(OPTION_HIDE|OPTION_CLOAK)) && !(src != NULL && (status_get_mode(src)&MD_DETECTOR)))
+			return 0;
+		break;
+	}
+	case BL_MOB:
+	case BL_HOM:
+		if (status->get_status_data(target)->hp == 0)
+			return 0;
+		break;
+	default:
+		break;
+	}
+	return 1;
+}
+
+static void bench_mob_free(struct mob_data *md);
+
+// Players and homunculi don't take damage, so a benchmark's world stays the same however long it runs.
+static int status_damage(struct block_list *src, struct block_list *target, int64 in_hp, int64 in_sp, int walkdelay, int flag)
+{
+	struct mob_data *md = BL_CAST(BL_MOB, target);
+	int64 tick = timer->gettick();
+	int hp, ret;
+
+	if (md == NULL || md->status.hp == 0 || md->bl.prev == NULL || in_hp <= 0)
+		return 0;
+
+	hp = (int)min(in_hp, (int64)md->status.hp);
+	md->status.hp -= hp;
+	if (walkdelay)
+		unit->set_walkdelay(target, tick, walkdelay, 0);
+	mob->damage(md, src, hp);
+	if (md->status.hp > 0)
+		return hp;
+
+	bench_count.kills++;
+	unit->stop_walking(target, 1);
+	unit->stop_attack(target);
+	map->freeblock_lock();
+	ret = mob->dead(md, src, flag&4 ? 3 : 0);
+	if (ret != 0) {
+		status->change_clear(target, 0);
+		if (ret&4) {
+			bench_mob_free(md);
+		} else if (ret&2) {
+			// unit->remove_map: off the map, still in the ID database for its respawn
+			map->delblock(&md->bl);
+		}
+	}
+	map->freeblock_unlock();
+	return hp;
+}
+
+static int status_heal(struct block_list *bl, int64 in_hp, int64 in_sp, int flag)
+{
+	struct mob_data *md = BL_CAST(BL_MOB, bl);
+	unsigned int hp;
+
+	if (md == NULL || md->status.hp == 0 || in_hp <= 0)
+		return 0;
+	hp = (unsigned int)min(in_hp, (int64)(md->status.max_hp - md->status.hp));
+	md->status.hp += hp;
+	mob->heal(md, hp);
+	return (int)hp;
+}
+
+/*==========================================
+ * Battle
+ *------------------------------------------*/
+static bool battle_check_range(struct block_list *src, struct block_list *bl, int range)
+{
+	int d;
+
+	nullpo_retr(false, src);
+	nullpo_retr(false, bl);
+
+	if (src->m != bl->m)
+		return false;
+	if (range > 0 && !check_distance_bl(src, bl, range))
+		return false;
+	if ((d = distance_bl(src, bl)) < 2)
+		return true;
+	return path->search_long(NULL, src, src->m, src->x, src->y, bl->x, bl->y, CELL_CHKWALL);
+}
+
+// Mobs against players and homunculi, nothing else
+static int battle_check_target(struct block_list *src, struct block_list *target, int flag)
+{
+	nullpo_ret(src);
+	nullpo_ret(target);
+
+	if (src == target)
+		return (flag&BCT_SELF) ? 1 : -1;
+	if (src->type == BL_MOB)
+		return (target->type&(BL_PC|BL_HOM)) ? 1 : -1;
+	if (src->type&(BL_PC|BL_HOM))
+		return target->type == BL_MOB ? 1 : -1;
+	return -1;
+}
+
+static int battle_get_target(struct block_list *bl)
+{
+	nullpo_ret(bl);
+	switch (bl->type) {
+	case BL_PC: return BL_UCAST(BL_PC, bl)->ud.target;
+	case BL_MOB: return BL_UCAST(BL_MOB, bl)->target_id;
+	case BL_HOM: return BL_UCAST(BL_HOM, bl)->ud.target;
+	default: return 0;
+	}
+}
+
+// conf/map/battle defaults
+static struct Battle_Config battle_config = {
+	.area_size = AREA_SIZE,
+	.pk_mode = 0,
+	.mob_ai = 0x000,
+	.mob_chase_refresh = 3,
+	.mob_npc_event_type = 1,
+	.mob_size_influence = 0,
+	.mobs_level_up = 0,
+	.mobs_level_up_exp_rate = 1,
+	.monster_loot_type = 0,
+	.mvp_tomb_enabled = 1,
+	.pvp_exp = 1,
+	.zeny_from_mobs = 0,
+	.exp_calc_type = 0,
+	.exp_bonus_attacker = 25,
+	.exp_bonus_max_attacker = 12,
+	.pet_attack_exp_rate = 100,
+	.pet_attack_exp_to_master = 0,
+	.alchemist_summon_reward = 1,
+	.allow_skill_without_day = 0,
+	.delay_battle_damage = 1,
+	.logarithmic_drops = 0,
+	.item_drop_adddrop_min = 1,
+	.item_drop_adddrop_max = 10000,
+	.drop_rate0item = 0,
+	.drops_by_luk = 0,
+	.drops_by_luk2 = 0,
+	.autoloot_adjust = 0,
+	.idle_no_autoloot = 0,
+	.homunculus_autoloot = 0,
+};
+
+/*==========================================
+ * Mobs
+ *------------------------------------------*/
+static struct mob_db *mob_db(int index)
+{
+	if (index < 0 || index > MAX_MOB_DB || mob->db_data[index] == NULL)
+		return mob->dummy;
+	return mob->db_data[index];
+}
+
+static int mob_delayspawn(int tid, int64 tick, int id, intptr_t data)
+{
+	struct mob_data *md = map->id2md(id);
+
+	if (md == NULL)
+		return 0;
+	if (md->spawn_timer != tid) {
+		ShowError("mob_delayspawn: Timer mismatch: %d != %d\n", tid, md->spawn_timer);
+		return 0;
+	}
+	md->spawn_timer = INVALID_TIMER;
+	mob->spawn(md);
+	return 0;
+}
+
+static int mob_setdelayspawn(struct mob_data *md)
+{
+	unsigned int spawntime;
+
+	nullpo_ret(md);
+
+	if (md->spawn == NULL)
+		return 0;
+	spawntime = md->spawn->delay1;
+	if (md->spawn->delay2 != 0)
+		spawntime += rnd() % md->spawn->delay2;
+	if (md->spawn_timer != INVALID_TIMER)
+		timer->delete(md->spawn_timer, mob_delayspawn);
+	md->spawn_timer = timer->add(timer->gettick() + max(spawntime, 1), mob_delayspawn, md->bl.id, 0);
+	return 0;
+}
+
+static int mob_spawn(struct mob_data *md)
+{
+	int64 tick = timer->gettick();
+	int i;
+
+	nullpo_ret(md);
+
+	md->last_thinktime = tick;
+	if (md->bl.prev != NULL) {
+		unit->stop_walking(&md->bl, 1);
+		unit->stop_attack(&md->bl);
+		map->delblock(&md->bl);
+	} else if (md->spawn_timer != INVALID_TIMER) {
+		timer->delete(md->spawn_timer, mob_delayspawn);
+		md->spawn_timer = INVALID_TIMER;
+	}
+
+	if (md->spawn != NULL) {
+		int16 x = md->spawn->x, y = md->spawn->y;
+
+		md->bl.m = md->spawn->m;
+		for (i = 0; i < 50; i++) {
+			x = md->spawn->x + (md->spawn->xs > 0 ? rnd() % (2 * md->spawn->xs + 1) - md->spawn->xs : 0);
+			y = md->spawn->y + (md->spawn->ys > 0 ? rnd() % (2 * md->spawn->ys + 1) - md->spawn->ys : 0);
+			if (!map->getcell(md->bl.m, &md->bl, x, y, CELL_CHKNOREACH))
+				break;
+		}
+		if (i == 50) {
+			x = md->spawn->x;
+			y = md->spawn->y;
+		}
+		md->bl.x = x;
+		md->bl.y = y;
+	}
+
+	memset(&md->state, 0, sizeof(md->state));
+	md->state.aggressive = (md->db->status.mode&MD_ANGRY) ? 1 : 0;
+	md->state.boss = (md->db->status.mode&MD_BOSS) ? 1 : 0;
+	memcpy(&md->status, &md->db->status, sizeof(md->status));
+	md->status.hp = md->status.max_hp;
+	md->attacked_id = 0;
+	md->target_id = 0;
+	md->move_fail_count = 0;
+	md->walktoxy_fail_count = 0;
+	md->ud.state.attack_continue = 0;
+	md->ud.target = 0;
+	md->ud.target_to = 0;
+	md->ud.canmove_tick = md->ud.canact_tick = tick;
+	md->next_walktime = tick + rnd() % 1000 + MIN_RANDOMWALKTIME;
+	md->last_linktime = tick;
+	md->dmgtick = tick - 5000;
+	md->last_pcneartime = 0;
+	md->min_chase = md->db->range3;
+	memset(md->dmglog, 0, sizeof(md->dmglog));
+	md->tdmg = 0;
+	if (md->lootitem != NULL)
+		memset(md->lootitem, 0, LOOTITEM_SIZE * sizeof(*md->lootitem));
+	md->lootitem_count = 0;
+
+	if (map->addblock(&md->bl) != 0)
+		return 2;
+	clif_count_area(&md->bl, 108); // ZC_NOTIFY_NEWENTRY
+	return 0;
+}
+
+static void mob_reload(void)
+{
+}
+
+static void mob_log_damage(struct mob_data *md, struct block_list *src, int damage)
+{
+	int char_id = 0, flag = MDLF_NORMAL;
+
+	nullpo_retv(md);
+	nullpo_retv(src);
+
+	if (damage < 0)
+		return;
+	switch (src->type) {
+	case BL_PC:
+		char_id = BL_UCAST(BL_PC, src)->status.char_id;
+		if (damage != 0)
+			md->attacked_id = src->id;
+		break;
+	case BL_HOM: {
+		struct homun_data *hd = BL_UCAST(BL_HOM, src);
+
+		flag = MDLF_HOMUN;
+		if (hd->master != NULL)
+			char_id = hd->master->status.char_id;
+		if (damage != 0)
+			md->attacked_id = src->id;
+		break;
+	}
+	default:
+		return;
+	}
+
+	if (char_id != 0) {
+		unsigned int mindmg = UINT_MAX;
+		int i, minpos = DAMAGELOG_SIZE - 1;
+
+		for (i = 0; i < DAMAGELOG_SIZE; i++) {
+			if (md->dmglog[i].id == char_id && md->dmglog[i].flag == flag)
+				break;
+			if (md->dmglog[i].id == 0) {
+				// Store data in first empty slot.
+				minpos = i;
+				mindmg = 0;
+			} else if (md->dmglog[i].dmg < mindmg) {
+				minpos = i;
+				mindmg = md->dmglog[i].dmg;
+			}
+		}
+		if (i < DAMAGELOG_SIZE) {
+			md->dmglog[i].dmg += damage;
+		} else {
+			md->dmglog[minpos].id = char_id;
+			md->dmglog[minpos].flag = flag;
+			md->dmglog[minpos].dmg = damage;
+		}
+	}
+}
+
+static void mob_damage(struct mob_data *md, struct block_list *src, int damage)
+{
+	if (damage > 0) {
+		if (UINT_MAX - (unsigned int)damage > md->tdmg)
+			md->tdmg += damage;
+		else
+			md->tdmg = UINT_MAX;
+	}
+	if (src != NULL)
+		mob->log_damage(md, src, damage);
+	md->dmgtick = timer->gettick();
+}
+
+static void mob_heal(struct mob_data *md, unsigned int heal)
+{
+}
+
+// mob_dead without the parts no plugin of this repo can observe: exp for the damage log,
+// the normal drops and the looted items, then the respawn.
+static int mob_dead(struct mob_data *md, struct block_list *src, int type)
+{
+	struct item item;
+	int first_charid = 0, i;
+	unsigned int best = 0;
+
+	nullpo_ret(md);
+
+	md->status.hp = 0;
+	for (i = 0; i < DAMAGELOG_SIZE && md->dmglog[i].id != 0; i++) {
+		struct map_session_data *tsd = map->charid2sd(md->dmglog[i].id);
+
+		if (tsd == NULL || tsd->bl.m != md->bl.m)
+			continue;
+		if (md->dmglog[i].dmg > best) {
+			best = md->dmglog[i].dmg;
+			first_charid = tsd->status.char_id;
+		}
+		pc->gainexp(tsd, &md->bl, (uint64)md->db->base_exp * md->dmglog[i].dmg / max(md->tdmg, 1),
+		            (uint64)md->db->job_exp * md->dmglog[i].dmg / max(md->tdmg, 1), false);
+	}
+
+	if (!(type&1) && !map->list[md->bl.m].flag.nomobloot) {
+		for (i = 0; i < MAX_MOB_DROP; i++) {
+			const struct mob_drop *drop = &md->db->dropitem[i];
+			int rate;
+
+			if (drop->nameid <= 0 || itemdb->exists(drop->nameid) == NULL)
+				continue;
+			rate = mob->drop_adjust(drop->p, 100, battle->bc->item_drop_adddrop_min, battle->bc->item_drop_adddrop_max);
+			if (rate <= rnd() % 10000 + 1)
+				continue;
+			memset(&item, 0, sizeof(item));
+			item.nameid = drop->nameid;
+			item.amount = 1;
+			item.identify = itemdb->isidentified(drop->nameid);
+			map->addflooritem(&md->bl, &item, 1, md->bl.m, md->bl.x, md->bl.y, first_charid, 0, 0, 0, false);
+		}
+		for (i = 0; i < md->lootitem_count; i++)
+			map->addflooritem(&md->bl, &md->lootitem[i], md->lootitem[i].amount, md->bl.m, md->bl.x, md->bl.y, first_charid, 0, 0, 0, false);
+	}
+	md->lootitem_count = 0;
+	clif->clearunit_area(&md->bl, CLR_DEAD);
+	md->status.hp = 1;
+
+	if (md->spawn == NULL)
+		return 5;
+	mob->setdelayspawn(md);
+	return 3;
+}
+
+static int mob_timer_delete(int tid, int64 tick, int id, intptr_t data)
+{
+	return 0;
+}
+
+static int mob_deleteslave(struct mob_data *md)
+{
+	return 0;
+}
+
+static bool mob_is_clone(int class_)
+{
+	return class_ >= MOB_CLONE_START && class_ < MOB_CLONE_END;
+}
+
+static int mob_get_random_id(int type, int flag, int lv)
+{
+	return 0;
+}
+
+static void mob_mvptomb_create(struct mob_data *md, char *killer, time_t time)
+{
+}
+
+// Every mob within AREA_SIZE + ACTIVE_AI_RANGE of a player thinks
+static int mob_ai_hard(int tid, int64 tick, int id, intptr_t data)
+{
+	map->foreachpc(mob->ai_sub_foreachclient, tick);
+	return 0;
+}
+
+static int mob_ai_sub_foreachclient(struct map_session_data *sd, va_list ap)
+{
+	int64 tick = va_arg(ap, int64);
+
+	map->foreachinrange(mob->ai_sub_hard_timer, &sd->bl, AREA_SIZE + ACTIVE_AI_RANGE, BL_MOB, tick);
+	return 0;
+}
+
+static int mob_ai_sub_hard_timer(struct block_list *bl, va_list ap)
+{
+	struct mob_data *md = BL_UCAST(BL_MOB, bl);
+	int64 tick = va_arg(ap, int64);
+
+	bench_count.thinks++;
+	if (mob->ai_sub_hard(md, tick)) {
+		// Hard AI triggered.
+		if (!md->state.spotted)
+			md->state.spotted = 1;
+		md->last_pcneartime = tick;
+	}
+	return 0;
+}
+
+// The stock hard AI is not part of the stand-in: looternodelete brings its own
+static bool mob_ai_sub_hard(struct mob_data *md, int64 tick)
+{
+	return false;
+}
+
+static int mob_ai_sub_hard_activesearch(struct block_list *bl, va_list ap)
+{
+	struct mob_data *md;
+	struct block_list **target;
+	uint32 mode;
+	int dist;
+
+	nullpo_ret(bl);
+	md = va_arg(ap, struct mob_data *);
+	target = va_arg(ap, struct block_list **);
+	mode = va_arg(ap, uint32);
+
+	// If can't seek yet, not an enemy, or you can't attack it, skip.
+	if (md->bl.id == bl->id || *target == bl || !status->check_skilluse(&md->bl, bl, 0, 0))
+		return 0;
+	if ((mode&MD_TARGETWEAK) && status->get_lv(bl) >= md->level - 5)
+		return 0;
+	if (battle->check_target(&md->bl, bl, BCT_ENEMY) <= 0)
+		return 0;
+	if (bl->type == BL_PC && BL_UCAST(BL_PC, bl)->state.gangsterparadise && !(status_get_mode(&md->bl)&MD_BOSS))
+		return 0; // Gangster paradise protection.
+
+	dist = distance_bl(&md->bl, bl);
+	if ((*target == NULL || !check_distance_bl(&md->bl, *target, dist))
+	 && battle->check_range(&md->bl, bl, md->db->range2)) {
+		// Pick closest target
+		*target = bl;
+		md->target_id = bl->id;
+		md->min_chase = dist + md->db->range3;
+		if (md->min_chase > MAX_MINCHASE)
+			md->min_chase = MAX_MINCHASE;
+		return 1;
+	}
+	return 0;
+}
+
+static int mob_ai_sub_hard_changechase(struct block_list *bl, va_list ap)
+{
+	struct mob_data *md;
+	struct block_list **target;
+
+	nullpo_ret(bl);
+	md = va_arg(ap, struct mob_data *);
+	target = va_arg(ap, struct block_list **);
+
+	// If can't seek yet, not an enemy, or you can't attack it, skip.
+	if (*target == bl || battle->check_target(&md->bl, bl, BCT_ENEMY) <= 0 || !status->check_skilluse(&md->bl, bl, 0, 0))
+		return 0;
+	if (battle->check_range(&md->bl, bl, md->status.rhw.range)) {
+		*target = bl;
+		md->target_id = bl->id;
+		md->min_chase = md->db->range3;
+	}
+	return 1;
+}
+
+// No battlegrounds off-server
+static int mob_ai_sub_hard_bg_ally(struct block_list *bl, va_list ap)
+{
+	return 0;
+}
+
+static int mob_ai_sub_hard_lootsearch(struct block_list *bl, va_list ap)
+{
+	struct mob_data *md;
+	struct block_list **target;
+	int dist;
+
+	md = va_arg(ap, struct mob_data *);
+	target = va_arg(ap, struct block_list **);
+
+	dist = distance_bl(&md->bl, bl);
+	if (mob->can_reach(md, bl, dist + 1, MSS_LOOT)
+	 && (*target == NULL || !check_distance_bl(&md->bl, *target, dist))) { // New target closer than previous one.
+		*target = bl;
+		md->target_id = bl->id;
+		md->min_chase = md->db->range3;
+	}
+	return 0;
+}
+
+// No slaves off-server
+static int mob_ai_sub_hard_slavemob(struct mob_data *md, int64 tick)
+{
+	return 0;
+}
+
+static bool mob_can_reach(struct mob_data *md, struct block_list *bl, int range, int state)
+{
+	int easy, dx, dy;
+
+	nullpo_retr(false, md);
+	nullpo_retr(false, bl);
+
+	switch (state) {
+	case MSS_RUSH:
+	case MSS_FOLLOW:
+		easy = 0; // (battle->bc->mob_ai&0x1 ? 0 : 1);
+		break;
+	default:
+		easy = 1;
+		break;
+	}
+	if (bl->m != md->bl.m || !check_distance_bl(&md->bl, bl, range))
+		return false;
+
+	// Walk to the cell next to the target, on our side of it
+	dx = (bl->x > md->bl.x) - (bl->x < md->bl.x);
+	dy = (bl->y > md->bl.y) - (bl->y < md->bl.y);
+	if ((dx != 0 || dy != 0) && map->getcell(bl->m, &md->bl, bl->x - dx, bl->y - dy, CELL_CHKNOPASS))
+		dx = dy = 0;
+	return path->search(NULL, &md->bl, md->bl.m, md->bl.x, md->bl.y, bl->x - dx, bl->y - dy, easy, CELL_CHKNOREACH);
+}
+
+static bool mob_can_changetarget(const struct mob_data *md, const struct block_list *target, uint32 mode)
+{
+	nullpo_retr(false, md);
+	nullpo_retr(false, target);
+
+	switch (md->state.skillstate) {
+	case MSS_BERSERK:
+		if (!(mode&MD_CHANGETARGET_MELEE))
+			return false;
+		return ((battle->bc->mob_ai&0x4) || check_distance_bl(&md->bl, target, 3));
+	case MSS_RUSH:
+		return (mode&MD_CHANGETARGET_CHASE) != 0;
+	case MSS_FOLLOW:
+	case MSS_ANGRY:
+	case MSS_IDLE:
+	case MSS_WALK:
+	case MSS_LOOT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool mob_randomwalk(struct mob_data *md, int64 tick)
+{
+	const int d = 7;
+	int i, r, x, y;
+
+	if (DIFF_TICK(md->next_walktime, tick) > 0 || !(status_get_mode(&md->bl)&MD_CANMOVE) || !unit->can_move(&md->bl))
+		return false;
+
+	for (i = 0; i < 16; i++) {
+		r = rnd();
+		x = md->bl.x + r % (d * 2 + 1) - d;
+		y = md->bl.y + r / (d * 2 + 1) % (d * 2 + 1) - d;
+		if (map->getcell(md->bl.m, &md->bl, x, y, CELL_CHKPASS) && unit->walktoxy(&md->bl, x, y, 8) == 0)
+			break;
+	}
+	if (i == 16)
+		return false;
+
+	md->state.skillstate = MSS_WALK;
+	md->next_walktime = tick + rnd() % 1000 + MIN_RANDOMWALKTIME + md->ud.walkpath.path_len * md->status.speed;
+	return true;
+}
+
+static int mob_unlocktarget(struct mob_data *md, int64 tick)
+{
+	nullpo_ret(md);
+
+	switch (md->state.skillstate) {
+	case MSS_WALK:
+		if (md->ud.walktimer != INVALID_TIMER)
+			break;
+		// Because it is not unset when the mob finishes walking.
+		md->state.skillstate = MSS_IDLE;
+		/* Fall through */
+	case MSS_IDLE:
+		// Random walk.
+		if (!md->master_id && DIFF_TICK(md->next_walktime, tick) <= 0 && !mob_randomwalk(md, tick))
+			// Delay next random walk when this one failed.
+			md->next_walktime = tick + rnd() % 1000;
+		break;
+	default:
+		unit->stop_attack(&md->bl);
+		unit->stop_walking(&md->bl, 1);
+		md->state.skillstate = MSS_IDLE;
+		if (battle->bc->mob_ai&0x8) // Walk instantly after dropping target
+			md->next_walktime = tick + rnd() % 1000;
+		else
+			md->next_walktime = tick + rnd() % 1000 + MIN_RANDOMWALKTIME;
+		break;
+	}
+	if (md->target_id) {
+		md->target_id = 0;
+		md->ud.target_to = 0;
+		md->ud.target = 0;
+	}
+	return 0;
+}
+
+// No warps off-server
+static bool mob_warpchase(struct mob_data *md, struct block_list *target)
+{
+	return false;
+}
+
+// No mob skills off-server
+static int mob_use_skill(struct mob_data *md, int64 tick, int event)
+{
+	return 0;
+}
+
+static unsigned int mob_drop_adjust(int baserate, int rate_adjust, unsigned short rate_min, unsigned short rate_max)
+{
+	double rate = baserate;
+
+	if (battle->bc->logarithmic_drops && rate_adjust > 0 && rate_adjust != 100 && baserate > 0) {
+		// Logarithmic drops equation by Ishizu-Chan
+		//Equation: Droprate(x,y) = x * (5 - log(x)) ^ (ln(y) / ln(5))
+		//x is the normal Droprate, y is the Modificator.
+		rate = rate * pow((5.0 - log10(rate)), (log(rate_adjust/100.) / log(5.0))) + 0.5;
+	} else {
+		//Classical linear rate adjustment.
+		rate = rate * rate_adjust / 100;
+	}
+	return (unsigned int)cap_value(rate, rate_min, rate_max);
+}
+
+static void mob_setdropitem_options(struct item *item, struct optdrop_group *options)
+{
+	int i;
+
+	nullpo_retv(item);
+
+	if (options == NULL)
+		return;
+	for (i = 0; i < options->optioncount && i < MAX_ITEM_OPTIONS; i++)
+		item->option[i] = options->options[i];
+}
+
+static struct item_drop *mob_setdropitem(int nameid, struct optdrop_group *options, int qty, struct item_data *data)
+{
+	struct item_drop *drop;
+
+	CREATE(drop, struct item_drop, 1);
+	drop->item_data.nameid = nameid;
+	drop->item_data.amount = qty;
+	drop->item_data.identify = data != NULL ? itemdb->isidentified2(data) : itemdb->isidentified(nameid);
+	mob->setdropitem_options(&drop->item_data, options);
+	return drop;
+}
+
+static struct item_drop *mob_setlootitem(struct item *item)
+{
+	struct item_drop *drop;
+
+	CREATE(drop, struct item_drop, 1);
+	memcpy(&drop->item_data, item, sizeof(struct item));
+	return drop;
+}
+
+static void mob_item_drop(struct mob_data *md, struct item_drop_list *dlist, struct item_drop *ditem, int loot, int drop_rate, unsigned short flag)
+{
+	ditem->next = dlist->item;
+	dlist->item = ditem;
+}
+
+static int mob_delay_item_drop(int tid, int64 tick, int id, intptr_t data)
+{
+	struct item_drop_list *list = (struct item_drop_list *)data;
+	struct item_drop *ditem = list->item;
+
+	while (ditem != NULL) {
+		struct item_drop *next = ditem->next;
+
+		map->addflooritem(NULL, &ditem->item_data, ditem->item_data.amount, list->m, list->x, list->y,
+		                  list->first_charid, list->second_charid, list->third_charid, 0, ditem->showdropeffect);
+		aFree(ditem);
+		ditem = next;
+	}
+	aFree(list);
+	return 0;
+}
+
+static void bench_mob_free(struct mob_data *md)
+{
+	int i;
+
+	if (md->spawn_timer != INVALID_TIMER) {
+		timer->delete(md->spawn_timer, mob_delayspawn);
+		md->spawn_timer = INVALID_TIMER;
+	}
+	for (i = 0; i < SC_MAX; i++)
+		aFree(md->sc.data[i]);
+	map->deliddb(&md->bl);
+	map->delblock(&md->bl);
+	bench_hpm_free_store(&md->hdata);
+	aFree(md->lootitem);
+	aFree(md->spawn);
+	map_freeblock(&md->bl);
+}
+
+/*==========================================
+ * Players
+ *------------------------------------------*/
+static bool pc_db_checkid(int class)
+{
+	return (class >= 0 && class < 1000) || (class >= 4001 && class < 4300);
+}
+
+static int pc_checkskill(struct map_session_data *sd, uint16 skill_id)
+{
+	return 0;
+}
+
+static int pc_isautolooting(struct map_session_data *sd, int nameid)
+{
+	return 0;
+}
+
+static int pc_level_penalty_mod(int diff, unsigned char race, uint32 mode, int type)
+{
+	return 100;
+}
+
+static int pc_additem(struct map_session_data *sd, const struct item *item_data, int amount, int log_type)
+{
+	clif->additem(sd, 0, amount, 0);
+	return 0;
+}
+
+static int pc_getzeny(struct map_session_data *sd, int zeny, int type, struct map_session_data *tsd)
+{
+	sd->status.zeny += zeny;
+	return 0;
+}
+
+static bool pc_gainexp(struct map_session_data *sd, struct block_list *src, uint64 base_exp, uint64 job_exp, bool is_quest)
+{
+	sd->status.base_exp += base_exp;
+	sd->status.job_exp += job_exp;
+	return true;
+}
+
+static int pc_addfame(struct map_session_data *sd, int ranktype, int count)
+{
+	sd->status.fame += count;
+	return 0;
+}
+
+static int pc_setparam(struct map_session_data *sd, int type, int val)
+{
+	return 0;
+}
+
+static int pc_setregistry(struct map_session_data *sd, int64 reg, int val)
+{
+	return 0;
+}
+
+static bool pc_sg_day(void)
+{
+	return false;
+}
+
+/*==========================================
+ * Homunculi
+ *------------------------------------------*/
+#define HOMUN_STATS(hp, sp, str, agi, vit, int_, dex, luk) { (hp), (sp), (str), (agi), (vit), (int_), (dex), (luk) }
+
+// db/pre-re/homunculus_db.txt: base stats, then growth per level (tenths of a point for
+// str..luk) and the evolution bonus (whole points).
+static const struct s_homunculus_db homun_db_init[] = {
+	{ 6001, 6009, "Lif", HOMUN_STATS(150, 40, 12, 20, 15, 35, 24, 15),
+		HOMUN_STATS(60, 4, 4, 4, 4, 4, 5, 5), HOMUN_STATS(100, 9, 10, 10, 10, 11, 11, 11),
+		HOMUN_STATS(1, 1, 1, 1, 1, 1, 1, 1), HOMUN_STATS(10, 10, 10, 10, 10, 10, 10, 10), 6097, 700, 60000, 0, RC_DEMIHUMAN, SZ_SMALL, SZ_MEDIUM },
+	{ 6002, 6010, "Amistr", HOMUN_STATS(320, 10, 20, 17, 35, 11, 24, 12),
+		HOMUN_STATS(80, 1, 5, 4, 4, 0, 3, 3), HOMUN_STATS(130, 4, 13, 10, 10, 3, 10, 10),
+		HOMUN_STATS(1, 1, 1, 1, 1, 1, 1, 1), HOMUN_STATS(10, 10, 10, 10, 10, 10, 10, 10), 6098, 700, 60000, 0, RC_BRUTE, SZ_SMALL, SZ_MEDIUM },
+	{ 6003, 6011, "Filir", HOMUN_STATS(90, 25, 29, 35, 9, 8, 30, 9),
+		HOMUN_STATS(45, 3, 4, 6, 0, 3, 4, 3), HOMUN_STATS(75, 6, 10, 13, 3, 10, 10, 10),
+		HOMUN_STATS(1, 1, 1, 1, 1, 1, 1, 1), HOMUN_STATS(10, 10, 10, 10, 10, 10, 10, 10), 6099, 700, 60000, 0, RC_BRUTE, SZ_SMALL, SZ_MEDIUM },
+	{ 6004, 6012, "Vanilmirth", HOMUN_STATS(80, 11, 11, 11, 11, 11, 11, 11),
+		HOMUN_STATS(30, 1, 1, 1, 1, 1, 1, 1), HOMUN_STATS(150, 6, 20, 20, 20, 20, 20, 20),
+		HOMUN_STATS(1, 1, 1, 1, 1, 1, 1, 1), HOMUN_STATS(10, 10, 10, 10, 10, 10, 10, 10), 6100, 700, 60000, 0, RC_FORMLESS, SZ_SMALL, SZ_MEDIUM },
+};
+
+static int rnd_value(int min_, int max_)
+{
+	if (min_ >= max_)
+		return min_;
+	return min_ + rnd() % (max_ - min_ + 1);
+}
+
+static unsigned int homun_exp_next(int level)
+{
+	return (unsigned int)level * level * 10;
+}
+
+static void homun_reload(void)
+{
+}
+
+static void homun_sync_status(struct homun_data *hd)
+{
+	struct s_homunculus *hom = &hd->homunculus;
+
+	hom->hp = hom->max_hp;
+	hom->sp = hom->max_sp;
+	hd->battle_status.max_hp = hd->battle_status.hp = hom->max_hp;
+	hd->battle_status.max_sp = hd->battle_status.sp = hom->max_sp;
+	hd->base_status = hd->battle_status;
+}
+
+static bool homun_levelup(struct homun_data *hd)
+{
+	struct s_homunculus *hom;
+	const struct h_stats *gmin, *gmax;
+
+	if (hd == NULL || hd->homunculusDB == NULL)
+		return false;
+	hom = &hd->homunculus;
+	if (hom->level >= MAX_HOMUN_LEVEL || hd->exp_next == 0 || hom->exp < hd->exp_next)
+		return false;
+
+	gmin = &hd->homunculusDB->gmin;
+	gmax = &hd->homunculusDB->gmax;
+	hom->exp -= hd->exp_next;
+	hom->level++;
+	hd->exp_next = homun_exp_next(hom->level);
+	hom->max_hp += rnd_value(gmin->HP, gmax->HP);
+	hom->max_sp += rnd_value(gmin->SP, gmax->SP);
+	hom->str += rnd_value(gmin->str, gmax->str);
+	hom->agi += rnd_value(gmin->agi, gmax->agi);
+	hom->vit += rnd_value(gmin->vit, gmax->vit);
+	hom->int_ += rnd_value(gmin->int_, gmax->int_);
+	hom->dex += rnd_value(gmin->dex, gmax->dex);
+	hom->luk += rnd_value(gmin->luk, gmax->luk);
+	homun_sync_status(hd);
+	bench_count.levelups++;
+	return true;
+}
+
+static bool homun_evolve(struct homun_data *hd)
+{
+	struct s_homunculus *hom;
+	const struct h_stats *emin, *emax;
+
+	if (!homun_alive(hd) || hd->homunculus.class_ == hd->homunculusDB->evo_class)
+		return false;
+	hom = &hd->homunculus;
+	emin = &hd->homunculusDB->emin;
+	emax = &hd->homunculusDB->emax;
+	hom->prev_class = hom->class_;
+	hom->class_ = hd->homunculusDB->evo_class;
+	hom->max_hp += rnd_value(emin->HP, emax->HP);
+	hom->max_sp += rnd_value(emin->SP, emax->SP);
+	hom->str += 10 * rnd_value(emin->str, emax->str);
+	hom->agi += 10 * rnd_value(emin->agi, emax->agi);
+	hom->vit += 10 * rnd_value(emin->vit, emax->vit);
+	hom->int_ += 10 * rnd_value(emin->int_, emax->int_);
+	hom->dex += 10 * rnd_value(emin->dex, emax->dex);
+	hom->luk += 10 * rnd_value(emin->luk, emax->luk);
+	hom->intimacy = 500;
+	homun_sync_status(hd);
+	return true;
+}
+
+static bool homun_delete(struct homun_data *hd, int emote)
+{
+	return true;
+}
+
+static bool homun_gainexp(struct homun_data *hd, unsigned int exp)
+{
+	if (!homun_alive(hd))
+		return false;
+	hd->homunculus.exp += exp;
+	bench_count.exp_gained += exp;
+	while (hd->homunculus.exp >= hd->exp_next && homun->levelup(hd))
+		;
+	return true;
+}
+
+/*==========================================
+ * Items: every ID exists, as an identified etc item
+ *------------------------------------------*/
+static struct item_data *itemdb_array[MAX_ITEMDB];
+
+static struct item_data *itemdb_exists(int nameid)
+{
+	struct item_data *id;
+
+	if (nameid <= 0 || nameid >= MAX_ITEMDB)
+		return NULL;
+	if ((id = itemdb_array[nameid]) == NULL) {
+		CREATE(id, struct item_data, 1);
+		id->nameid = nameid;
+		snprintf(id->name, sizeof(id->name), "Item_%d", nameid);
+		snprintf(id->jname, sizeof(id->jname), "Item %d", nameid);
+		id->type = IT_ETC;
+		id->weight = 10;
+		itemdb_array[nameid] = id;
+	}
+	return id;
+}
+
+static struct item_data *itemdb_search(int nameid)
+{
+	struct item_data *id = itemdb->exists(nameid);
+
+	return id != NULL ? id : itemdb->exists(512); // Apple, as the dummy item
+}
+
+static int itemdb_isidentified(int nameid)
+{
+	return 1;
+}
+
+static int itemdb_isidentified2(struct item_data *data)
+{
+	return 1;
+}
+
+static int itemdb_chain_item(unsigned short chain_id, int *rate)
+{
+	if (rate != NULL)
+		*rate = 0;
+	return 0;
+}
+
+/*==========================================
+ * Everything else a plugin calls and no benchmark looks at
+ *------------------------------------------*/
+static struct party_data *party_search(int party_id)
+{
+	return NULL;
+}
+
+static int party_exp_share(struct party_data *p, struct block_list *src, unsigned int base_exp, unsigned int job_exp, int zeny)
+{
+	return 0;
+}
+
+static int party_share_loot(struct party_data *p, struct map_session_data *sd, struct item *item_data, int first_charid)
+{
+	return 0;
+}
+
+static void guild_castledatasave(int castle_id, int index, int value)
+{
+}
+
+static int npc_event(struct map_session_data *sd, const char *eventname, int ontouch)
+{
+	return 0;
+}
+
+static int npc_event_do(const char *name)
+{
+	return 0;
+}
+
+static int npc_script_event(struct map_session_data *sd, enum npce_event type)
+{
+	return 0;
+}
+
+static int64 script_add_variable(const char *varname)
+{
+	return 0;
+}
+
+static void quest_update_objective(struct map_session_data *sd, const struct mob_data *md)
+{
+}
+
+static int quest_update_objective_sub(struct block_list *bl, va_list ap)
+{
+	return 0;
+}
+
+static void achievement_validate_mob_kill(struct map_session_data *sd, int mob_id)
+{
+}
+
+static int pet_create_egg(struct map_session_data *sd, int item_id)
+{
+	return 0;
+}
+
+static int mercenary_kills(struct mercenary_data *md)
+{
+	return 0;
+}
+
+static void log_pick_mob(struct mob_data *md, enum e_log_pick_type type, int amount, struct item *itm, struct item_data *data)
+{
+}
+
+static void log_mvpdrop(struct map_session_data *sd, int monster_id, int *log_mvp)
+{
+}
+
+/*==========================================
+ * @commands and their messages
+ *------------------------------------------*/
+static const char *atcommand_msgfd(int fd, int msg_number)
+{
+	switch (msg_number) {
+	case 153: return "%s is Unknown Command.";
+	case 154: return "%s failed.";
+	case 1254: return "You do not have a homunculus.";
+	case 1266: return "Homunculus growth stats (Lv %d %s):";
+	case 1267: return "Max HP: %d (%d~%d)";
+	case 1268: return "Max SP: %d (%d~%d)";
+	case 1269: return "Str: %d (%d~%d)";
+	case 1270: return "Agi: %d (%d~%d)";
+	case 1271: return "Vit: %d (%d~%d)";
+	case 1272: return "Int: %d (%d~%d)";
+	case 1273: return "Dex: %d (%d~%d)";
+	case 1274: return "Luk: %d (%d~%d)";
+	default: return "";
+	}
+}
+
+/*==========================================
+ * Interfaces
+ *------------------------------------------*/
+static struct map_interface map_s = {
+	.db_path = "db",
+	.autosave_interval = 300000,
+	.addblock = map_addblock,
+	.delblock = map_delblock,
+	.moveblock = map_moveblock,
+	.freeblock_lock = map_freeblock_lock,
+	.freeblock_unlock = map_freeblock_unlock,
+	.addiddb = map_addiddb,
+	.deliddb = map_deliddb,
+	.id2bl = map_id2bl,
+	.id2md = map_id2md,
+	.id2sd = map_id2sd,
+	.charid2sd = map_charid2sd,
+	.foreachinrange = map_foreachinrange,
+	.foreachinarea = map_foreachinarea,
+	.foreachpc = map_foreachpc,
+	.foreachmob = map_foreachmob,
+	.getcell = map_getcell,
+	.setcell = map_setcell,
+	.setgatcell = map_setgatcell,
+	.addflooritem = map_addflooritem,
+	.clearflooritem_timer = map_clearflooritem_timer,
+	.clearflooritem = map_clearflooritem,
+	.race_id2mask = map_race_id2mask,
+};
+struct map_interface *map = &map_s;
+
+static struct mob_interface mob_s = {
+	.db = mob_db,
+	.spawn = mob_spawn,
+	.setdelayspawn = mob_setdelayspawn,
+	.reload = mob_reload,
+	.dead = mob_dead,
+	.damage = mob_damage,
+	.heal = mob_heal,
+	.log_damage = mob_log_damage,
+	.timer_delete = mob_timer_delete,
+	.deleteslave = mob_deleteslave,
+	.is_clone = mob_is_clone,
+	.get_random_id = mob_get_random_id,
+	.mvptomb_create = mob_mvptomb_create,
+	.ai_hard = mob_ai_hard,
+	.ai_sub_foreachclient = mob_ai_sub_foreachclient,
+	.ai_sub_hard_timer = mob_ai_sub_hard_timer,
+	.ai_sub_hard = mob_ai_sub_hard,
+	.ai_sub_hard_activesearch = mob_ai_sub_hard_activesearch,
+	.ai_sub_hard_changechase = mob_ai_sub_hard_changechase,
+	.ai_sub_hard_bg_ally = mob_ai_sub_hard_bg_ally,
+	.ai_sub_hard_lootsearch = mob_ai_sub_hard_lootsearch,
+	.ai_sub_hard_slavemob = mob_ai_sub_hard_slavemob,
+	.can_reach = mob_can_reach,
+	.can_changetarget = mob_can_changetarget,
+	.unlocktarget = mob_unlocktarget,
+	.warpchase = mob_warpchase,
+	.use_skill = mob_use_skill,
+	.drop_adjust = mob_drop_adjust,
+	.setdropitem = mob_setdropitem,
+	.setdropitem_options = mob_setdropitem_options,
+	.setlootitem = mob_setlootitem,
+	.item_drop = mob_item_drop,
+	.delay_item_drop = mob_delay_item_drop,
+};
+struct mob_interface *mob = &mob_s;
+
+static struct unit_interface unit_s = {
+	.bl2ud = unit_bl2ud,
+	.walktoxy = unit_walktoxy,
+	.walk_tobl = unit_walktobl,
+	.can_move = unit_can_move,
+	.set_walkdelay = unit_set_walkdelay,
+	.attack = unit_attack,
+	.attempt_escape = unit_attempt_escape,
+	.stop_walking = unit_stop_walking,
+	.stop_attack = unit_stop_attack,
+};
+struct unit_interface *unit = &unit_s;
+
+static struct status_interface status_s = {
+	.get_status_data = status_get_status_data,
+	.get_sc = status_get_sc,
+	.get_class = status_get_class,
+	.get_lv = status_get_lv,
+	.change_start = status_change_start,
+	.change_end_ = status_change_end_,
+	.change_clear = status_change_clear,
+	.check_skilluse = status_check_skilluse,
+	.damage = status_damage,
+	.heal = status_heal,
+};
+struct status_interface *status = &status_s;
+
+static struct path_interface path_s = {
+	.search = path_search,
+	.search_long = path_search_long,
+	.check_distance = path_check_distance,
+	.distance = path_distance,
+};
+struct path_interface *path = &path_s;
+
+static struct battle_interface battle_s = {
+	.bc = &battle_config,
+	.check_range = battle_check_range,
+	.check_target = battle_check_target,
+	.get_target = battle_get_target,
+};
+struct battle_interface *battle = &battle_s;
+
+static struct clif_interface clif_s = {
+	.message = clif_message,
+	.send_selforarea = clif_send_selforarea,
+	.mobname_normal_ack = clif_mobname_normal_ack,
+	.additem = clif_additem,
+	.takeitem = clif_takeitem,
+	.clearunit_area = clif_clearunit_area,
+	.clearunit_delayed = clif_clearunit_delayed,
+	.item_drop_announce = clif_item_drop_announce,
+	.mission_info = clif_mission_info,
+	.mvp_effect = clif_mvp_effect,
+	.mvp_exp = clif_mvp_exp,
+	.mvp_item = clif_mvp_item,
+};
+struct clif_interface *clif = &clif_s;
+
+static struct pc_interface pc_s = {
+	.sg_info = {
+		{ SG_SUN_BLESS, SG_SUN_BLESS, SG_SUN_BLESS, "PC_FEEL_SUN", "PC_HATE_MOB_SUN", pc_sg_day },
+		{ SG_MOON_BLESS, SG_MOON_BLESS, SG_MOON_BLESS, "PC_FEEL_MOON", "PC_HATE_MOB_MOON", pc_sg_day },
+		{ SG_STAR_BLESS, SG_STAR_BLESS, SG_STAR_BLESS, "PC_FEEL_STAR", "PC_HATE_MOB_STAR", pc_sg_day },
+	},
+	.db_checkid = pc_db_checkid,
+	.checkskill = pc_checkskill,
+	.isautolooting = pc_isautolooting,
+	.level_penalty_mod = pc_level_penalty_mod,
+	.additem = pc_additem,
+	.getzeny = pc_getzeny,
+	.gainexp = pc_gainexp,
+	.addfame = pc_addfame,
+	.setparam = pc_setparam,
+	.setregistry = pc_setregistry,
+};
+struct pc_interface *pc = &pc_s;
+
+static struct homunculus_interface homun_s = {
+	.reload = homun_reload,
+	.levelup = homun_levelup,
+	.evolve = homun_evolve,
+	.delete = homun_delete,
+	.gainexp = homun_gainexp,
+};
+struct homunculus_interface *homun = &homun_s;
+
+static struct itemdb_interface itemdb_s = {
+	.search = itemdb_search,
+	.exists = itemdb_exists,
+	.isidentified = itemdb_isidentified,
+	.isidentified2 = itemdb_isidentified2,
+	.chain_item = itemdb_chain_item,
+};
+struct itemdb_interface *itemdb = &itemdb_s;
+
+static struct party_interface party_s = { party_search, party_exp_share, party_share_loot };
+struct party_interface *party = &party_s;
+static struct guild_interface guild_s = { guild_castledatasave };
+struct guild_interface *guild = &guild_s;
+static struct npc_interface npc_s = { npc_event, npc_event_do, npc_script_event };
+struct npc_interface *npc = &npc_s;
+static struct script_interface script_s = { script_add_variable };
+struct script_interface *script = &script_s;
+static struct quest_interface quest_s = { quest_update_objective, quest_update_objective_sub };
+struct quest_interface *quest = &quest_s;
+static struct achievement_interface achievement_s = { achievement_validate_mob_kill };
+struct achievement_interface *achievement = &achievement_s;
+static struct pet_interface pet_s = { pet_create_egg };
+struct pet_interface *pet = &pet_s;
+static struct mercenary_interface mercenary_s = { mercenary_kills };
+struct mercenary_interface *mercenary = &mercenary_s;
+static struct log_interface log_s = { log_pick_mob, log_mvpdrop };
+struct log_interface *logs = &log_s;
+
+static struct atcommand_interface atcommand_s = {
+	.at_symbol = '@',
+	.char_symbol = '#',
+	.exec = bench_atcommand_exec,
+	.msgfd = atcommand_msgfd,
+};
+struct atcommand_interface *atcommand = &atcommand_s;
+
+/*==========================================
+ * bench.h
+ *------------------------------------------*/
+static void bench_usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [-s scale] [-d db_path] [-v]\n"
+	                "  -s scale    Multiply the size of the workload (default 1)\n"
+	                "  -d db_path  Where the plugin reads its databases from (default \"%s\")\n"
+	                "  -v          Print what the @commands answer\n", name, map->db_path);
+	exit(EXIT_FAILURE);
+}
+
+void bench_init(int argc, char **argv)
+{
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+			bench_scale_factor = max(atoi(argv[++i]), 1);
+		} else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+			map->db_path = argv[++i];
+		} else if (strcmp(argv[i], "-v") == 0) {
+			bench_echo_on = true;
+		} else {
+			bench_usage(argv[0]);
+		}
+	}
+
+	rnd_seed(20190530);
+	id_db = idb_alloc(DB_OPT_BASE);
+	mobid_db = idb_alloc(DB_OPT_BASE);
+	charid_db = idb_alloc(DB_OPT_BASE);
+	CREATE(mob->dummy, struct mob_db, 1);
+	safestrncpy(mob->dummy->sprite, "DUMMY", sizeof(mob->dummy->sprite));
+	safestrncpy(mob->dummy->name, "Dummy", sizeof(mob->dummy->name));
+	safestrncpy(mob->dummy->jname, "Dummy", sizeof(mob->dummy->jname));
+	mob->dummy->vd.class = 1; // INVISIBLE_CLASS
+	memcpy(homun->db, homun_db_init, sizeof(homun_db_init));
+	bench_hpm_init();
+}
+
+void bench_plugin_init(void)
+{
+	plugin_init();
+	// do_init runs after the plugins are loaded, so the AI timer gets the hooked mob->ai_hard
+	timer->add_interval(timer->gettick() + MIN_MOBTHINKTIME, mob->ai_hard, 0, 0, MIN_MOBTHINKTIME);
+	server_online();
+	bench_counters_reset();
+}
+
+void bench_plugin_final(void)
+{
+	plugin_final();
+}
+
+int16 bench_add_map(const char *name, int16 xs, int16 ys)
+{
+	struct map_data *mp;
+	int16 m = map->count++;
+
+	RECREATE(map->list, struct map_data, map->count);
+	mp = &map->list[m];
+	memset(mp, 0, sizeof(*mp));
+	safestrncpy(mp->name, name, sizeof(mp->name));
+	mp->index = m + 1;
+	mp->m = m;
+	mp->xs = xs;
+	mp->ys = ys;
+	mp->bxs = (xs + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	mp->bys = (ys + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	mp->cell = aCalloc(xs * ys, sizeof(*mp->cell));
+	mp->block = aCalloc(mp->bxs * mp->bys, sizeof(*mp->block));
+	mp->block_mob = aCalloc(mp->bxs * mp->bys, sizeof(*mp->block_mob));
+	mp->bexp = mp->jexp = 100;
+	return m;
+}
+
+void bench_add_mob_db(int class_, const char *name, int level, uint32 mode, int hp, int range2, int range3)
+{
+	struct mob_db *db;
+
+	if (class_ <= 0 || class_ > MAX_MOB_DB) {
+		ShowFatalError("bench_add_mob_db: invalid class %d\n", class_);
+		exit(EXIT_FAILURE);
+	}
+	if ((db = mob->db_data[class_]) == NULL)
+		CREATE(db, struct mob_db, 1);
+	db->mob_id = class_;
+	safestrncpy(db->sprite, name, sizeof(db->sprite));
+	safestrncpy(db->name, name, sizeof(db->name));
+	safestrncpy(db->jname, name, sizeof(db->jname));
+	db->lv = level;
+	db->base_exp = level * 20;
+	db->job_exp = level * 15;
+	db->range2 = range2;
+	db->range3 = range3;
+	db->status.max_hp = db->status.hp = hp;
+	db->status.max_sp = db->status.sp = 10;
+	db->status.str = db->status.agi = db->status.vit = db->status.int_ = db->status.dex = db->status.luk = 1 + level / 2;
+	db->status.batk = 10 + level * 2;
+	db->status.rhw.atk = level * 3;
+	db->status.rhw.range = 1;
+	db->status.speed = 200;
+	db->status.amotion = 1000;
+	db->status.adelay = 1500;
+	db->status.dmotion = 500;
+	db->status.mode = mode;
+	db->status.race = RC_BRUTE;
+	db->status.size = SZ_MEDIUM;
+	db->vd.class = class_;
+	// Some of everything: common etc items, an equipment and a card drop
+	db->dropitem[0].nameid = 909; db->dropitem[0].p = 7000;
+	db->dropitem[1].nameid = 1202; db->dropitem[1].p = 100;
+	db->dropitem[2].nameid = 938; db->dropitem[2].p = 400;
+	db->dropitem[3].nameid = 512; db->dropitem[3].p = 1000;
+	db->dropitem[4].nameid = 4001; db->dropitem[4].p = 1;
+	mob->db_data[class_] = db;
+}
+
+struct map_session_data *bench_add_pc(int16 m, int16 x, int16 y)
+{
+	struct map_session_data *sd;
+	int n = bench_pc_count;
+
+	CREATE(sd, struct map_session_data, 1);
+	sd->bl.type = BL_PC;
+	sd->bl.id = ++bench_last_account;
+	sd->bl.m = m;
+	sd->bl.x = x;
+	sd->bl.y = y;
+	sd->status.account_id = sd->bl.id;
+	sd->status.char_id = START_CHAR_NUM + n;
+	sd->status.class = 4008; // Lord Knight
+	sd->status.base_level = 99;
+	sd->status.job_level = 50;
+	snprintf(sd->status.name, sizeof(sd->status.name), "bench%d", n);
+	sd->status.mod_exp = sd->status.mod_drop = sd->status.mod_death = 100;
+	sd->battle_status.max_hp = sd->battle_status.hp = 1000000;
+	sd->battle_status.max_sp = sd->battle_status.sp = 1000;
+	sd->battle_status.str = sd->battle_status.agi = sd->battle_status.vit = 99;
+	sd->battle_status.int_ = sd->battle_status.dex = sd->battle_status.luk = 60;
+	sd->battle_status.batk = 400;
+	sd->battle_status.rhw.atk = 200;
+	sd->battle_status.rhw.range = 1;
+	sd->battle_status.speed = 150;
+	sd->battle_status.amotion = 400;
+	sd->battle_status.adelay = 800;
+	sd->battle_status.race = RC_PLAYER;
+	sd->base_status = sd->battle_status;
+	sd->vd.class = sd->status.class;
+	sd->permissions = PC_PERM_USE_ALL_COMMANDS;
+	sd->state.active = 1;
+	sd->idletime = time(NULL);
+	sd->invincible_timer = INVALID_TIMER;
+	unit_dataset(&sd->bl, &sd->ud);
+	sd->fd = bench_session_new(sd);
+
+	RECREATE(bench_pcs, struct map_session_data *, bench_pc_count + 1);
+	bench_pcs[bench_pc_count++] = sd;
+	map->addiddb(&sd->bl);
+	map->addblock(&sd->bl);
+	return sd;
+}
+
+struct mob_data *bench_add_mob(int class_, int16 m, int16 x, int16 y)
+{
+	struct mob_data *md;
+	struct mob_db *db = mob->db(class_);
+
+	CREATE(md, struct mob_data, 1);
+	md->bl.type = BL_MOB;
+	md->bl.id = bench_new_id();
+	md->bl.m = m;
+	md->bl.x = x;
+	md->bl.y = y;
+	md->class_ = class_;
+	md->db = db;
+	md->vd = &db->vd;
+	md->base_status = &db->status;
+	md->level = db->lv;
+	safestrncpy(md->name, db->jname, sizeof(md->name));
+	md->deletetimer = INVALID_TIMER;
+	md->spawn_timer = INVALID_TIMER;
+	if (db->status.mode&MD_LOOTER)
+		md->lootitem = aCalloc(LOOTITEM_SIZE, sizeof(struct item));
+	unit_dataset(&md->bl, &md->ud);
+
+	CREATE(md->spawn, struct spawn_data, 1);
+	md->spawn->class_ = class_;
+	md->spawn->m = m;
+	md->spawn->x = x;
+	md->spawn->y = y;
+	md->spawn->xs = md->spawn->ys = 10;
+	md->spawn->num = 1;
+	md->spawn->active = 1;
+	md->spawn->delay1 = 5000;
+	md->spawn->delay2 = 1000;
+	safestrncpy(md->spawn->name, db->jname, sizeof(md->spawn->name));
+
+	map->addiddb(&md->bl);
+	mob->spawn(md);
+	return md;
+}
+
+struct homun_data *bench_add_homun(struct map_session_data *sd, int class_, int level)
+{
+	struct homun_data *hd;
+	struct s_homunculus *hom;
+	static int hom_id = 0;
+	int i;
+
+	ARR_FIND(0, ARRAYLENGTH(homun_db_init), i, homun->db[i].base_class == class_ || homun->db[i].evo_class == class_);
+	if (i == ARRAYLENGTH(homun_db_init)) {
+		ShowFatalError("bench_add_homun: no homunculus class %d\n", class_);
+		exit(EXIT_FAILURE);
+	}
+
+	CREATE(hd, struct homun_data, 1);
+	hd->bl.type = BL_HOM;
+	hd->bl.id = bench_new_id();
+	hd->bl.m = sd->bl.m;
+	hd->bl.x = sd->bl.x;
+	hd->bl.y = sd->bl.y;
+	hd->master = sd;
+	hd->homunculusDB = &homun->db[i];
+	hd->hungry_timer = INVALID_TIMER;
+	unit_dataset(&hd->bl, &hd->ud);
+
+	hom = &hd->homunculus;
+	safestrncpy(hom->name, hd->homunculusDB->name, sizeof(hom->name));
+	hom->hom_id = ++hom_id;
+	hom->char_id = sd->status.char_id;
+	hom->class_ = hd->homunculusDB->base_class;
+	hom->level = 1;
+	hom->intimacy = 25000;
+	hom->hunger = 50;
+	hom->max_hp = hd->homunculusDB->base.HP;
+	hom->max_sp = hd->homunculusDB->base.SP;
+	hom->str = hd->homunculusDB->base.str * 10;
+	hom->agi = hd->homunculusDB->base.agi * 10;
+	hom->vit = hd->homunculusDB->base.vit * 10;
+	hom->int_ = hd->homunculusDB->base.int_ * 10;
+	hom->dex = hd->homunculusDB->base.dex * 10;
+	hom->luk = hd->homunculusDB->base.luk * 10;
+	hd->exp_next = homun_exp_next(1);
+	homun_sync_status(hd);
+
+	sd->hd = hd;
+	sd->status.hom_id = hom->hom_id;
+	map->addiddb(&hd->bl);
+
+	// As @homlevel does it
+	while (hom->level < level) {
+		hom->exp += hd->exp_next;
+		if (!homun->levelup(hd))
+			break;
+	}
+	if (class_ == hd->homunculusDB->evo_class)
+		homun->evolve(hd);
+	return hd;
+}
+
+void bench_del_homun(struct map_session_data *sd)
+{
+	struct homun_data *hd = sd->hd;
+
+	if (hd == NULL)
+		return;
+	homun->delete(hd, -1);
+	map->deliddb(&hd->bl);
+	sd->hd = NULL;
+	sd->status.hom_id = 0;
+	aFree(hd);
+}
+
+int bench_drop_item(int nameid, int16 m, int16 x, int16 y)
+{
+	struct item item;
+
+	memset(&item, 0, sizeof(item));
+	item.nameid = nameid;
+	item.amount = 1;
+	item.identify = 1;
+	return map->addflooritem(NULL, &item, 1, m, x, y, 0, 0, 0, 0, false);
+}
+
+void bench_wall(int16 m, int16 x0, int16 y0, int16 x1, int16 y1)
+{
+	int16 x, y;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++)
+			map->setcell(m, x, y, CELL_WALKABLE, false);
+	}
+}
+
+int64 bench_tick(int ms)
+{
+	int64 tick = timer->gettick() + ms;
+
+	bench_timer_run(tick);
+	sockt->last_tick = (time_t)(tick / 1000);
+	return tick;
+}
+
+bool bench_command(struct map_session_data *sd, const char *command)
+{
+	return atcommand->exec(sd->fd, sd, command, true);
+}
+
+void bench_echo(bool on)
+{
+	bench_echo_on = on;
+}
+
+int bench_scale(int n)
+{
+	return n * bench_scale_factor;
+}
+
+void bench_counters_reset(void)
+{
+	memset(&bench_count, 0, sizeof(bench_count));
+}
+
+void bench_header(const char *title)
+{
+	printf("\n== %s\n", title);
+}
+
+void bench_result(const char *name, uint64 calls, uint64 ns)
+{
+	printf("%-40s %10"PRIu64" calls %10.1f ns/call %12.0f calls/s\n", name, calls,
+	       calls != 0 ? (double)ns / calls : 0.0, ns != 0 ? calls * 1e9 / ns : 0.0);
+}
+
+void bench_note(const char *format, ...)
+{
+	va_list ap;
+
+	printf("   ");
+	va_start(ap, format);
+	vprintf(format, ap);
+	va_end(ap);
+	printf("\n");
+}
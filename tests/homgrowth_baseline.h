@@ -0,0 +1,490 @@
+//===== Plugin tests =========================================
+//= homgrowth_baseline.h
+//===== Description: =========================================
+//= The rank classifier of @homgrowth.c before the threshold
+//= arrays: its StatRange tables, written out as { min, max }
+//= per rank and stat, and its get_stat_rank. Used as the
+//= reference of homgrowth_rank_test.c, do not fix it.
+//============================================================
+#ifndef HOMGROWTH_BASELINE_H
+#define HOMGROWTH_BASELINE_H
+
+enum { BASELINE_VANILMIRTH, BASELINE_FILIR, BASELINE_AMISTR, BASELINE_LIF, BASELINE_TYPES };
+
+static const char *baseline_type_names[BASELINE_TYPES] = { "Vanilmirth", "Filir", "Amistr", "Lif" };
+
+// baseline_ranges[type][band][rank][stat] = { min, max }, band being level / 10 capped at 9.
+// Abysmal has no min and Amazing no max, they were left at 0.
+static const float baseline_ranges[BASELINE_TYPES][HOMGROWTH_BANDS][RANK_COUNT][STAT_COUNT][2] = {
+	{ // Vanilmirth
+		{ // VanilStatRange10
+			{ { 0.000f, 70.000f }, { 0.000f, 2.333f }, { 0.000f, 0.667f }, { 0.000f, 0.667f }, { 0.000f, 0.667f }, { 0.000f, 0.667f }, { 0.000f, 0.667f }, { 0.000f, 0.667f } },
+			{ { 70.000f, 74.444f }, { 2.333f, 2.778f }, { 0.667f, 0.778f }, { 0.667f, 0.778f }, { 0.667f, 0.778f }, { 0.667f, 0.778f }, { 0.667f, 0.778f }, { 0.667f, 0.778f } },
+			{ { 74.444f, 80.000f }, { 2.778f, 3.111f }, { 0.778f, 0.889f }, { 0.778f, 0.889f }, { 0.778f, 0.889f }, { 0.778f, 0.889f }, { 0.778f, 0.889f }, { 0.778f, 0.889f } },
+			{ { 80.000f, 86.667f }, { 3.111f, 3.333f }, { 0.889f, 1.000f }, { 0.889f, 1.000f }, { 0.889f, 1.000f }, { 0.889f, 1.000f }, { 0.889f, 1.000f }, { 0.889f, 1.000f } },
+			{ { 86.667f, 92.222f }, { 3.333f, 3.667f }, { 1.000f, 1.222f }, { 1.000f, 1.222f }, { 1.000f, 1.222f }, { 1.000f, 1.222f }, { 1.000f, 1.222f }, { 1.000f, 1.222f } },
+			{ { 92.222f, 98.889f }, { 3.667f, 3.889f }, { 1.222f, 1.333f }, { 1.222f, 1.333f }, { 1.222f, 1.333f }, { 1.222f, 1.333f }, { 1.222f, 1.333f }, { 1.222f, 1.333f } },
+			{ { 98.889f, 104.444f }, { 3.889f, 4.222f }, { 1.333f, 1.444f }, { 1.333f, 1.444f }, { 1.333f, 1.444f }, { 1.333f, 1.444f }, { 1.333f, 1.444f }, { 1.333f, 1.444f } },
+			{ { 104.444f, 108.889f }, { 4.222f, 4.667f }, { 1.444f, 1.556f }, { 1.444f, 1.556f }, { 1.444f, 1.556f }, { 1.444f, 1.556f }, { 1.444f, 1.556f }, { 1.444f, 1.556f } },
+			{ { 108.889f, 0.000f }, { 4.667f, 0.000f }, { 1.556f, 0.000f }, { 1.556f, 0.000f }, { 1.556f, 0.000f }, { 1.556f, 0.000f }, { 1.556f, 0.000f }, { 1.556f, 0.000f } },
+		},
+		{ // VanilStatRange20
+			{ { 0.000f, 76.316f }, { 0.000f, 2.842f }, { 0.000f, 0.789f }, { 0.000f, 0.789f }, { 0.000f, 0.789f }, { 0.000f, 0.789f }, { 0.000f, 0.789f }, { 0.000f, 0.789f } },
+			{ { 76.316f, 79.474f }, { 2.842f, 3.105f }, { 0.789f, 0.842f }, { 0.789f, 0.842f }, { 0.789f, 0.842f }, { 0.789f, 0.842f }, { 0.789f, 0.842f }, { 0.789f, 0.842f } },
+			{ { 79.474f, 83.158f }, { 3.105f, 3.263f }, { 0.842f, 0.947f }, { 0.842f, 0.947f }, { 0.842f, 0.947f }, { 0.842f, 0.947f }, { 0.842f, 0.947f }, { 0.842f, 0.947f } },
+			{ { 83.158f, 87.895f }, { 3.263f, 3.421f }, { 0.947f, 1.053f }, { 0.947f, 1.053f }, { 0.947f, 1.053f }, { 0.947f, 1.053f }, { 0.947f, 1.053f }, { 0.947f, 1.053f } },
+			{ { 87.895f, 91.579f }, { 3.421f, 3.579f }, { 1.053f, 1.158f }, { 1.053f, 1.158f }, { 1.053f, 1.158f }, { 1.053f, 1.158f }, { 1.053f, 1.158f }, { 1.053f, 1.158f } },
+			{ { 91.579f, 96.316f }, { 3.579f, 3.737f }, { 1.158f, 1.263f }, { 1.158f, 1.263f }, { 1.158f, 1.263f }, { 1.158f, 1.263f }, { 1.158f, 1.263f }, { 1.158f, 1.263f } },
+			{ { 96.316f, 100.000f }, { 3.737f, 3.895f }, { 1.263f, 1.368f }, { 1.263f, 1.368f }, { 1.263f, 1.368f }, { 1.263f, 1.368f }, { 1.263f, 1.368f }, { 1.263f, 1.368f } },
+			{ { 100.000f, 102.632f }, { 3.895f, 4.158f }, { 1.368f, 1.421f }, { 1.368f, 1.421f }, { 1.368f, 1.421f }, { 1.368f, 1.421f }, { 1.368f, 1.421f }, { 1.368f, 1.421f } },
+			{ { 102.632f, 0.000f }, { 4.158f, 0.000f }, { 1.421f, 0.000f }, { 1.421f, 0.000f }, { 1.421f, 0.000f }, { 1.421f, 0.000f }, { 1.421f, 0.000f }, { 1.421f, 0.000f } },
+		},
+		{ // VanilStatRange30
+			{ { 0.000f, 78.966f }, { 0.000f, 3.034f }, { 0.000f, 0.828f }, { 0.000f, 0.828f }, { 0.000f, 0.828f }, { 0.000f, 0.828f }, { 0.000f, 0.828f }, { 0.000f, 0.828f } },
+			{ { 78.966f, 81.379f }, { 3.034f, 3.207f }, { 0.828f, 0.897f }, { 0.828f, 0.897f }, { 0.828f, 0.897f }, { 0.828f, 0.897f }, { 0.828f, 0.897f }, { 0.828f, 0.897f } },
+			{ { 81.379f, 84.483f }, { 3.207f, 3.310f }, { 0.897f, 0.966f }, { 0.897f, 0.966f }, { 0.897f, 0.966f }, { 0.897f, 0.966f }, { 0.897f, 0.966f }, { 0.897f, 0.966f } },
+			{ { 84.483f, 88.276f }, { 3.310f, 3.448f }, { 0.966f, 1.069f }, { 0.966f, 1.069f }, { 0.966f, 1.069f }, { 0.966f, 1.069f }, { 0.966f, 1.069f }, { 0.966f, 1.069f } },
+			{ { 88.276f, 91.379f }, { 3.448f, 3.552f }, { 1.069f, 1.138f }, { 1.069f, 1.138f }, { 1.069f, 1.138f }, { 1.069f, 1.138f }, { 1.069f, 1.138f }, { 1.069f, 1.138f } },
+			{ { 91.379f, 95.172f }, { 3.552f, 3.690f }, { 1.138f, 1.241f }, { 1.138f, 1.241f }, { 1.138f, 1.241f }, { 1.138f, 1.241f }, { 1.138f, 1.241f }, { 1.138f, 1.241f } },
+			{ { 95.172f, 97.931f }, { 3.690f, 3.793f }, { 1.241f, 1.310f }, { 1.241f, 1.310f }, { 1.241f, 1.310f }, { 1.241f, 1.310f }, { 1.241f, 1.310f }, { 1.241f, 1.310f } },
+			{ { 97.931f, 100.345f }, { 3.793f, 3.966f }, { 1.310f, 1.379f }, { 1.310f, 1.379f }, { 1.310f, 1.379f }, { 1.310f, 1.379f }, { 1.310f, 1.379f }, { 1.310f, 1.379f } },
+			{ { 100.345f, 0.000f }, { 3.966f, 0.000f }, { 1.379f, 0.000f }, { 1.379f, 0.000f }, { 1.379f, 0.000f }, { 1.379f, 0.000f }, { 1.379f, 0.000f }, { 1.379f, 0.000f } },
+		},
+		{ // VanilStatRange40
+			{ { 0.000f, 80.513f }, { 0.000f, 3.128f }, { 0.000f, 0.872f }, { 0.000f, 0.872f }, { 0.000f, 0.872f }, { 0.000f, 0.872f }, { 0.000f, 0.872f }, { 0.000f, 0.872f } },
+			{ { 80.513f, 82.564f }, { 3.128f, 3.282f }, { 0.872f, 0.923f }, { 0.872f, 0.923f }, { 0.872f, 0.923f }, { 0.872f, 0.923f }, { 0.872f, 0.923f }, { 0.872f, 0.923f } },
+			{ { 82.564f, 85.128f }, { 3.282f, 3.359f }, { 0.923f, 0.974f }, { 0.923f, 0.974f }, { 0.923f, 0.974f }, { 0.923f, 0.974f }, { 0.923f, 0.974f }, { 0.923f, 0.974f } },
+			{ { 85.128f, 88.462f }, { 3.359f, 3.462f }, { 0.974f, 1.051f }, { 0.974f, 1.051f }, { 0.974f, 1.051f }, { 0.974f, 1.051f }, { 0.974f, 1.051f }, { 0.974f, 1.051f } },
+			{ { 88.462f, 91.282f }, { 3.462f, 3.538f }, { 1.051f, 1.128f }, { 1.051f, 1.128f }, { 1.051f, 1.128f }, { 1.051f, 1.128f }, { 1.051f, 1.128f }, { 1.051f, 1.128f } },
+			{ { 91.282f, 94.615f }, { 3.538f, 3.641f }, { 1.128f, 1.205f }, { 1.128f, 1.231f }, { 1.128f, 1.231f }, { 1.128f, 1.231f }, { 1.128f, 1.231f }, { 1.128f, 1.231f } },
+			{ { 94.615f, 96.923f }, { 3.641f, 3.718f }, { 1.205f, 1.282f }, { 1.231f, 1.282f }, { 1.231f, 1.282f }, { 1.231f, 1.282f }, { 1.231f, 1.282f }, { 1.231f, 1.282f } },
+			{ { 96.923f, 98.974f }, { 3.718f, 3.872f }, { 1.282f, 1.333f }, { 1.282f, 1.333f }, { 1.282f, 1.333f }, { 1.282f, 1.333f }, { 1.282f, 1.333f }, { 1.282f, 1.333f } },
+			{ { 98.974f, 0.000f }, { 3.872f, 0.000f }, { 1.333f, 0.000f }, { 1.333f, 0.000f }, { 1.333f, 0.000f }, { 1.333f, 0.000f }, { 1.333f, 0.000f }, { 1.333f, 0.000f } },
+		},
+		{ // VanilStatRange50
+			{ { 0.000f, 81.633f }, { 0.000f, 3.163f }, { 0.000f, 0.898f }, { 0.000f, 0.898f }, { 0.000f, 0.898f }, { 0.000f, 0.898f }, { 0.000f, 0.898f }, { 0.000f, 0.898f } },
+			{ { 81.633f, 83.469f }, { 3.163f, 3.306f }, { 0.898f, 0.939f }, { 0.898f, 0.939f }, { 0.898f, 0.939f }, { 0.898f, 0.939f }, { 0.898f, 0.939f }, { 0.898f, 0.939f } },
+			{ { 83.469f, 85.714f }, { 3.306f, 3.388f }, { 0.939f, 1.000f }, { 0.939f, 1.000f }, { 0.939f, 1.000f }, { 0.939f, 1.000f }, { 0.939f, 1.000f }, { 0.939f, 1.000f } },
+			{ { 85.714f, 88.776f }, { 3.388f, 3.469f }, { 1.000f, 1.061f }, { 1.000f, 1.061f }, { 1.000f, 1.061f }, { 1.000f, 1.061f }, { 1.000f, 1.061f }, { 1.000f, 1.061f } },
+			{ { 88.776f, 91.224f }, { 3.469f, 3.531f }, { 1.061f, 1.122f }, { 1.061f, 1.122f }, { 1.061f, 1.122f }, { 1.061f, 1.122f }, { 1.061f, 1.122f }, { 1.061f, 1.122f } },
+			{ { 91.224f, 94.082f }, { 3.531f, 3.612f }, { 1.122f, 1.204f }, { 1.122f, 1.204f }, { 1.122f, 1.204f }, { 1.122f, 1.204f }, { 1.122f, 1.204f }, { 1.122f, 1.204f } },
+			{ { 94.082f, 96.122f }, { 3.612f, 3.694f }, { 1.204f, 1.265f }, { 1.204f, 1.265f }, { 1.204f, 1.265f }, { 1.204f, 1.265f }, { 1.204f, 1.265f }, { 1.204f, 1.265f } },
+			{ { 96.122f, 97.959f }, { 3.694f, 3.837f }, { 1.265f, 1.306f }, { 1.265f, 1.306f }, { 1.265f, 1.306f }, { 1.265f, 1.306f }, { 1.265f, 1.306f }, { 1.265f, 1.306f } },
+			{ { 97.959f, 0.000f }, { 3.837f, 0.000f }, { 1.306f, 0.000f }, { 1.306f, 0.000f }, { 1.306f, 0.000f }, { 1.306f, 0.000f }, { 1.306f, 0.000f }, { 1.306f, 0.000f } },
+		},
+		{ // VanilStatRange60
+			{ { 0.000f, 82.373f }, { 0.000f, 3.203f }, { 0.000f, 0.915f }, { 0.000f, 0.915f }, { 0.000f, 0.915f }, { 0.000f, 0.915f }, { 0.000f, 0.915f }, { 0.000f, 0.915f } },
+			{ { 82.373f, 84.068f }, { 3.203f, 3.322f }, { 0.915f, 0.949f }, { 0.915f, 0.949f }, { 0.915f, 0.949f }, { 0.915f, 0.949f }, { 0.915f, 0.949f }, { 0.915f, 0.949f } },
+			{ { 84.068f, 86.102f }, { 3.322f, 3.407f }, { 0.949f, 1.000f }, { 0.949f, 1.000f }, { 0.949f, 1.000f }, { 0.949f, 1.000f }, { 0.949f, 1.000f }, { 0.949f, 1.000f } },
+			{ { 86.102f, 88.814f }, { 3.407f, 3.475f }, { 1.000f, 1.068f }, { 1.000f, 1.068f }, { 1.000f, 1.068f }, { 1.000f, 1.068f }, { 1.000f, 1.068f }, { 1.000f, 1.068f } },
+			{ { 88.814f, 91.186f }, { 3.475f, 3.525f }, { 1.068f, 1.119f }, { 1.068f, 1.136f }, { 1.068f, 1.136f }, { 1.068f, 1.136f }, { 1.068f, 1.136f }, { 1.068f, 1.136f } },
+			{ { 91.186f, 93.729f }, { 3.525f, 3.593f }, { 1.119f, 1.186f }, { 1.136f, 1.203f }, { 1.136f, 1.203f }, { 1.136f, 1.203f }, { 1.136f, 1.203f }, { 1.136f, 1.203f } },
+			{ { 93.729f, 95.593f }, { 3.593f, 3.678f }, { 1.186f, 1.237f }, { 1.203f, 1.237f }, { 1.203f, 1.237f }, { 1.203f, 1.237f }, { 1.203f, 1.237f }, { 1.203f, 1.237f } },
+			{ { 95.593f, 97.288f }, { 3.678f, 3.797f }, { 1.237f, 1.288f }, { 1.237f, 1.288f }, { 1.237f, 1.288f }, { 1.237f, 1.288f }, { 1.237f, 1.288f }, { 1.237f, 1.288f } },
+			{ { 97.288f, 0.000f }, { 3.797f, 0.000f }, { 1.288f, 0.000f }, { 1.288f, 0.000f }, { 1.288f, 0.000f }, { 1.288f, 0.000f }, { 1.288f, 0.000f }, { 1.288f, 0.000f } },
+		},
+		{ // VanilStatRange70
+			{ { 0.000f, 82.899f }, { 0.000f, 3.261f }, { 0.000f, 0.928f }, { 0.000f, 0.928f }, { 0.000f, 0.928f }, { 0.000f, 0.928f }, { 0.000f, 0.928f }, { 0.000f, 0.928f } },
+			{ { 82.899f, 84.493f }, { 3.261f, 3.362f }, { 0.928f, 0.971f }, { 0.928f, 0.971f }, { 0.928f, 0.971f }, { 0.928f, 0.971f }, { 0.928f, 0.971f }, { 0.928f, 0.971f } },
+			{ { 84.493f, 86.377f }, { 3.362f, 3.420f }, { 0.971f, 1.014f }, { 0.971f, 1.014f }, { 0.971f, 1.014f }, { 0.971f, 1.014f }, { 0.971f, 1.014f }, { 0.971f, 1.014f } },
+			{ { 86.377f, 88.841f }, { 3.420f, 3.478f }, { 1.014f, 1.072f }, { 1.014f, 1.072f }, { 1.014f, 1.072f }, { 1.014f, 1.072f }, { 1.014f, 1.072f }, { 1.014f, 1.072f } },
+			{ { 88.841f, 91.014f }, { 3.478f, 3.522f }, { 1.072f, 1.130f }, { 1.072f, 1.130f }, { 1.072f, 1.130f }, { 1.072f, 1.130f }, { 1.072f, 1.130f }, { 1.072f, 1.130f } },
+			{ { 91.014f, 93.478f }, { 3.522f, 3.580f }, { 1.130f, 1.188f }, { 1.130f, 1.188f }, { 1.130f, 1.188f }, { 1.130f, 1.188f }, { 1.130f, 1.188f }, { 1.130f, 1.188f } },
+			{ { 93.478f, 95.217f }, { 3.580f, 3.638f }, { 1.188f, 1.232f }, { 1.188f, 1.232f }, { 1.188f, 1.232f }, { 1.188f, 1.232f }, { 1.188f, 1.232f }, { 1.188f, 1.232f } },
+			{ { 95.217f, 96.667f }, { 3.638f, 3.739f }, { 1.232f, 1.275f }, { 1.232f, 1.275f }, { 1.232f, 1.275f }, { 1.232f, 1.275f }, { 1.232f, 1.275f }, { 1.232f, 1.275f } },
+			{ { 96.667f, 0.000f }, { 3.739f, 0.000f }, { 1.275f, 0.000f }, { 1.275f, 0.000f }, { 1.275f, 0.000f }, { 1.275f, 0.000f }, { 1.275f, 0.000f }, { 1.275f, 0.000f } },
+		},
+		{ // VanilStatRange80
+			{ { 0.000f, 83.291f }, { 0.000f, 3.316f }, { 0.000f, 0.937f }, { 0.000f, 0.937f }, { 0.000f, 0.937f }, { 0.000f, 0.937f }, { 0.000f, 0.937f }, { 0.000f, 0.937f } },
+			{ { 83.291f, 84.810f }, { 3.316f, 3.380f }, { 0.937f, 0.975f }, { 0.937f, 0.975f }, { 0.937f, 0.975f }, { 0.937f, 0.975f }, { 0.937f, 0.975f }, { 0.937f, 0.975f } },
+			{ { 84.810f, 86.582f }, { 3.380f, 3.430f }, { 0.975f, 1.013f }, { 0.975f, 1.013f }, { 0.975f, 1.013f }, { 0.975f, 1.013f }, { 0.975f, 1.013f }, { 0.975f, 1.013f } },
+			{ { 86.582f, 88.987f }, { 3.430f, 3.481f }, { 1.013f, 1.076f }, { 1.013f, 1.076f }, { 1.013f, 1.076f }, { 1.013f, 1.076f }, { 1.013f, 1.076f }, { 1.013f, 1.076f } },
+			{ { 88.987f, 91.013f }, { 3.481f, 3.519f }, { 1.076f, 1.127f }, { 1.076f, 1.127f }, { 1.076f, 1.127f }, { 1.076f, 1.127f }, { 1.076f, 1.127f }, { 1.076f, 1.127f } },
+			{ { 91.013f, 93.291f }, { 3.519f, 3.570f }, { 1.127f, 1.177f }, { 1.127f, 1.177f }, { 1.127f, 1.177f }, { 1.127f, 1.177f }, { 1.127f, 1.177f }, { 1.127f, 1.177f } },
+			{ { 93.291f, 94.937f }, { 3.570f, 3.620f }, { 1.177f, 1.228f }, { 1.177f, 1.228f }, { 1.177f, 1.228f }, { 1.177f, 1.228f }, { 1.177f, 1.228f }, { 1.177f, 1.228f } },
+			{ { 94.937f, 96.203f }, { 3.620f, 3.684f }, { 1.228f, 1.266f }, { 1.228f, 1.253f }, { 1.228f, 1.266f }, { 1.228f, 1.266f }, { 1.228f, 1.266f }, { 1.228f, 1.266f } },
+			{ { 96.203f, 0.000f }, { 3.684f, 0.000f }, { 1.266f, 0.000f }, { 1.266f, 0.000f }, { 1.266f, 0.000f }, { 1.266f, 0.000f }, { 1.266f, 0.000f }, { 1.266f, 0.000f } },
+		},
+		{ // VanilStatRange90
+			{ { 0.000f, 83.708f }, { 0.000f, 3.303f }, { 0.000f, 0.944f }, { 0.000f, 0.944f }, { 0.000f, 0.944f }, { 0.000f, 0.944f }, { 0.000f, 0.944f }, { 0.000f, 0.944f } },
+			{ { 83.708f, 85.169f }, { 3.303f, 3.382f }, { 0.944f, 0.978f }, { 0.944f, 0.978f }, { 0.944f, 0.978f }, { 0.944f, 0.978f }, { 0.944f, 0.978f }, { 0.944f, 0.978f } },
+			{ { 85.169f, 86.854f }, { 3.382f, 3.427f }, { 0.978f, 1.022f }, { 0.978f, 1.022f }, { 0.978f, 1.022f }, { 0.978f, 1.022f }, { 0.978f, 1.022f }, { 0.978f, 1.022f } },
+			{ { 86.854f, 88.989f }, { 3.427f, 3.483f }, { 1.022f, 1.079f }, { 1.022f, 1.079f }, { 1.022f, 1.079f }, { 1.022f, 1.079f }, { 1.022f, 1.079f }, { 1.022f, 1.079f } },
+			{ { 88.989f, 90.899f }, { 3.483f, 3.517f }, { 1.079f, 1.124f }, { 1.079f, 1.124f }, { 1.079f, 1.124f }, { 1.079f, 1.124f }, { 1.079f, 1.124f }, { 1.079f, 1.124f } },
+			{ { 90.899f, 93.034f }, { 3.517f, 3.573f }, { 1.124f, 1.180f }, { 1.124f, 1.180f }, { 1.124f, 1.180f }, { 1.124f, 1.180f }, { 1.124f, 1.180f }, { 1.124f, 1.180f } },
+			{ { 93.034f, 94.607f }, { 3.573f, 3.618f }, { 1.180f, 1.213f }, { 1.180f, 1.213f }, { 1.180f, 1.213f }, { 1.180f, 1.213f }, { 1.180f, 1.213f }, { 1.180f, 1.213f } },
+			{ { 94.607f, 95.843f }, { 3.618f, 3.697f }, { 1.213f, 1.258f }, { 1.213f, 1.247f }, { 1.213f, 1.247f }, { 1.213f, 1.247f }, { 1.213f, 1.247f }, { 1.213f, 1.247f } },
+			{ { 95.843f, 0.000f }, { 3.697f, 0.000f }, { 1.258f, 0.000f }, { 1.247f, 0.000f }, { 1.247f, 0.000f }, { 1.247f, 0.000f }, { 1.247f, 0.000f }, { 1.247f, 0.000f } },
+		},
+		{ // VanilStatRange99
+			{ { 0.000f, 84.082f }, { 0.000f, 3.296f }, { 0.000f, 0.959f }, { 0.000f, 0.959f }, { 0.000f, 0.959f }, { 0.000f, 0.949f }, { 0.000f, 0.959f }, { 0.000f, 0.959f } },
+			{ { 84.082f, 85.408f }, { 3.296f, 3.388f }, { 0.959f, 0.990f }, { 0.959f, 0.990f }, { 0.959f, 0.990f }, { 0.949f, 0.980f }, { 0.959f, 0.990f }, { 0.959f, 0.990f } },
+			{ { 85.408f, 86.939f }, { 3.388f, 3.439f }, { 0.990f, 1.031f }, { 0.990f, 1.031f }, { 0.990f, 1.020f }, { 0.980f, 1.020f }, { 0.990f, 1.031f }, { 0.990f, 1.031f } },
+			{ { 86.939f, 89.082f }, { 3.439f, 3.480f }, { 1.031f, 1.071f }, { 1.031f, 1.082f }, { 1.020f, 1.071f }, { 1.020f, 1.082f }, { 1.031f, 1.082f }, { 1.031f, 1.082f } },
+			{ { 89.082f, 90.918f }, { 3.480f, 3.520f }, { 1.071f, 1.122f }, { 1.082f, 1.122f }, { 1.071f, 1.122f }, { 1.082f, 1.122f }, { 1.082f, 1.122f }, { 1.082f, 1.122f } },
+			{ { 90.918f, 92.857f }, { 3.520f, 3.561f }, { 1.122f, 1.173f }, { 1.122f, 1.173f }, { 1.122f, 1.173f }, { 1.122f, 1.173f }, { 1.122f, 1.173f }, { 1.122f, 1.173f } },
+			{ { 92.857f, 94.388f }, { 3.561f, 3.612f }, { 1.173f, 1.214f }, { 1.173f, 1.214f }, { 1.173f, 1.214f }, { 1.173f, 1.214f }, { 1.173f, 1.214f }, { 1.173f, 1.214f } },
+			{ { 94.388f, 95.612f }, { 3.612f, 3.704f }, { 1.214f, 1.245f }, { 1.214f, 1.245f }, { 1.214f, 1.245f }, { 1.214f, 1.245f }, { 1.214f, 1.245f }, { 1.214f, 1.245f } },
+			{ { 95.612f, 0.000f }, { 3.704f, 0.000f }, { 1.245f, 0.000f }, { 1.245f, 0.000f }, { 1.245f, 0.000f }, { 1.245f, 0.000f }, { 1.245f, 0.000f }, { 1.245f, 0.000f } },
+		},
+	},
+	{ // Filir
+		{ // FilirStatRange10
+			{ { 0.000f, 54.444f }, { 0.000f, 4.000f }, { 0.000f, 0.444f }, { 0.000f, 0.667f }, { 0.000f, 0.000f }, { 0.000f, 0.333f }, { 0.000f, 0.444f }, { 0.000f, 0.333f } },
+			{ { 54.444f, 55.556f }, { 4.000f, 4.111f }, { 0.444f, 0.444f }, { 0.667f, 0.778f }, { 0.000f, 0.000f }, { 0.333f, 0.333f }, { 0.444f, 0.444f }, { 0.333f, 0.333f } },
+			{ { 55.556f, 56.667f }, { 4.111f, 4.333f }, { 0.444f, 0.556f }, { 0.778f, 0.778f }, { 0.000f, 0.000f }, { 0.333f, 0.444f }, { 0.444f, 0.556f }, { 0.333f, 0.444f } },
+			{ { 56.667f, 58.889f }, { 4.333f, 4.444f }, { 0.556f, 0.667f }, { 0.778f, 0.889f }, { 0.000f, 0.111f }, { 0.444f, 0.556f }, { 0.556f, 0.667f }, { 0.444f, 0.556f } },
+			{ { 58.889f, 60.000f }, { 4.444f, 4.556f }, { 0.667f, 0.778f }, { 0.889f, 1.000f }, { 0.111f, 0.111f }, { 0.556f, 0.667f }, { 0.667f, 0.778f }, { 0.556f, 0.667f } },
+			{ { 60.000f, 62.222f }, { 4.556f, 4.667f }, { 0.778f, 0.889f }, { 1.000f, 1.000f }, { 0.111f, 0.222f }, { 0.667f, 0.778f }, { 0.778f, 0.889f }, { 0.667f, 0.778f } },
+			{ { 62.222f, 63.333f }, { 4.667f, 4.889f }, { 0.889f, 1.000f }, { 1.000f, 1.111f }, { 0.222f, 0.222f }, { 0.778f, 0.778f }, { 0.889f, 1.000f }, { 0.778f, 0.778f } },
+			{ { 63.333f, 64.444f }, { 4.889f, 5.000f }, { 1.000f, 1.000f }, { 1.111f, 1.222f }, { 0.222f, 0.222f }, { 0.778f, 0.889f }, { 1.000f, 1.000f }, { 0.778f, 0.889f } },
+			{ { 64.444f, 0.000f }, { 5.000f, 0.000f }, { 1.000f, 0.000f }, { 1.222f, 0.000f }, { 0.222f, 0.000f }, { 0.889f, 0.000f }, { 1.000f, 0.000f }, { 0.889f, 0.000f } },
+		},
+		{ // FilirStatRange20
+			{ { 0.000f, 56.316f }, { 0.000f, 4.211f }, { 0.000f, 0.474f }, { 0.000f, 0.737f }, { 0.000f, 0.000f }, { 0.000f, 0.421f }, { 0.000f, 0.474f }, { 0.000f, 0.421f } },
+			{ { 56.316f, 57.368f }, { 4.211f, 4.316f }, { 0.474f, 0.526f }, { 0.737f, 0.789f }, { 0.000f, 0.000f }, { 0.421f, 0.421f }, { 0.474f, 0.526f }, { 0.421f, 0.421f } },
+			{ { 57.368f, 57.895f }, { 4.316f, 4.368f }, { 0.526f, 0.579f }, { 0.789f, 0.842f }, { 0.000f, 0.053f }, { 0.421f, 0.474f }, { 0.526f, 0.579f }, { 0.421f, 0.474f } },
+			{ { 57.895f, 59.474f }, { 4.368f, 4.474f }, { 0.579f, 0.684f }, { 0.842f, 0.895f }, { 0.053f, 0.053f }, { 0.474f, 0.579f }, { 0.579f, 0.684f }, { 0.474f, 0.579f } },
+			{ { 59.474f, 60.526f }, { 4.474f, 4.526f }, { 0.684f, 0.737f }, { 0.895f, 0.947f }, { 0.053f, 0.105f }, { 0.579f, 0.632f }, { 0.684f, 0.737f }, { 0.579f, 0.632f } },
+			{ { 60.526f, 61.579f }, { 4.526f, 4.632f }, { 0.737f, 0.789f }, { 0.947f, 1.000f }, { 0.105f, 0.158f }, { 0.632f, 0.684f }, { 0.737f, 0.789f }, { 0.632f, 0.684f } },
+			{ { 61.579f, 62.632f }, { 4.632f, 4.684f }, { 0.789f, 0.895f }, { 1.000f, 1.053f }, { 0.158f, 0.211f }, { 0.684f, 0.737f }, { 0.789f, 0.895f }, { 0.684f, 0.737f } },
+			{ { 62.632f, 63.158f }, { 4.684f, 4.789f }, { 0.895f, 0.895f }, { 1.053f, 1.105f }, { 0.211f, 0.211f }, { 0.737f, 0.789f }, { 0.895f, 0.895f }, { 0.737f, 0.789f } },
+			{ { 63.158f, 0.000f }, { 4.789f, 0.000f }, { 0.895f, 0.000f }, { 1.105f, 0.000f }, { 0.211f, 0.000f }, { 0.789f, 0.000f }, { 0.895f, 0.000f }, { 0.789f, 0.000f } },
+		},
+		{ // FilirStatRange30
+			{ { 0.000f, 57.241f }, { 0.000f, 4.345f }, { 0.000f, 0.517f }, { 0.000f, 0.793f }, { 0.000f, 0.034f }, { 0.000f, 0.448f }, { 0.000f, 0.517f }, { 0.000f, 0.448f } },
+			{ { 57.241f, 57.586f }, { 4.345f, 4.379f }, { 0.517f, 0.586f }, { 0.793f, 0.828f }, { 0.034f, 0.034f }, { 0.448f, 0.483f }, { 0.517f, 0.586f }, { 0.448f, 0.483f } },
+			{ { 57.586f, 58.621f }, { 4.379f, 4.414f }, { 0.586f, 0.621f }, { 0.828f, 0.862f }, { 0.034f, 0.069f }, { 0.483f, 0.517f }, { 0.586f, 0.621f }, { 0.483f, 0.517f } },
+			{ { 58.621f, 59.310f }, { 4.414f, 4.483f }, { 0.621f, 0.690f }, { 0.862f, 0.897f }, { 0.069f, 0.069f }, { 0.517f, 0.552f }, { 0.621f, 0.690f }, { 0.517f, 0.552f } },
+			{ { 59.310f, 60.345f }, { 4.483f, 4.517f }, { 0.690f, 0.724f }, { 0.897f, 0.931f }, { 0.069f, 0.103f }, { 0.552f, 0.621f }, { 0.690f, 0.724f }, { 0.552f, 0.621f } },
+			{ { 60.345f, 61.379f }, { 4.517f, 4.586f }, { 0.724f, 0.793f }, { 0.931f, 1.000f }, { 0.103f, 0.138f }, { 0.621f, 0.655f }, { 0.724f, 0.793f }, { 0.621f, 0.655f } },
+			{ { 61.379f, 62.069f }, { 4.586f, 4.621f }, { 0.793f, 0.828f }, { 1.000f, 1.034f }, { 0.138f, 0.172f }, { 0.655f, 0.690f }, { 0.793f, 0.828f }, { 0.655f, 0.690f } },
+			{ { 62.069f, 62.759f }, { 4.621f, 4.655f }, { 0.828f, 0.897f }, { 1.034f, 1.069f }, { 0.172f, 0.207f }, { 0.690f, 0.724f }, { 0.828f, 0.897f }, { 0.690f, 0.724f } },
+			{ { 62.759f, 0.000f }, { 4.655f, 0.000f }, { 0.897f, 0.000f }, { 1.069f, 0.000f }, { 0.207f, 0.000f }, { 0.724f, 0.000f }, { 0.897f, 0.000f }, { 0.724f, 0.000f } },
+		},
+		{ // FilirStatRange40
+			{ { 0.000f, 57.692f }, { 0.000f, 4.359f }, { 0.000f, 0.564f }, { 0.000f, 0.795f }, { 0.000f, 0.026f }, { 0.000f, 0.462f }, { 0.000f, 0.564f }, { 0.000f, 0.462f } },
+			{ { 57.692f, 58.205f }, { 4.359f, 4.410f }, { 0.564f, 0.590f }, { 0.795f, 0.821f }, { 0.026f, 0.051f }, { 0.462f, 0.487f }, { 0.564f, 0.590f }, { 0.462f, 0.487f } },
+			{ { 58.205f, 58.718f }, { 4.410f, 4.436f }, { 0.590f, 0.641f }, { 0.821f, 0.872f }, { 0.051f, 0.051f }, { 0.487f, 0.513f }, { 0.590f, 0.641f }, { 0.487f, 0.513f } },
+			{ { 58.718f, 59.487f }, { 4.436f, 4.487f }, { 0.641f, 0.692f }, { 0.872f, 0.897f }, { 0.051f, 0.077f }, { 0.513f, 0.564f }, { 0.641f, 0.692f }, { 0.513f, 0.564f } },
+			{ { 59.487f, 60.256f }, { 4.487f, 4.513f }, { 0.692f, 0.718f }, { 0.897f, 0.949f }, { 0.077f, 0.103f }, { 0.564f, 0.615f }, { 0.692f, 0.718f }, { 0.564f, 0.615f } },
+			{ { 60.256f, 61.026f }, { 4.513f, 4.564f }, { 0.718f, 0.795f }, { 0.949f, 0.974f }, { 0.103f, 0.128f }, { 0.615f, 0.667f }, { 0.718f, 0.795f }, { 0.615f, 0.667f } },
+			{ { 61.026f, 61.795f }, { 4.564f, 4.590f }, { 0.795f, 0.821f }, { 0.974f, 1.026f }, { 0.128f, 0.154f }, { 0.667f, 0.692f }, { 0.795f, 0.821f }, { 0.667f, 0.692f } },
+			{ { 61.795f, 62.308f }, { 4.590f, 4.641f }, { 0.821f, 0.846f }, { 1.026f, 1.051f }, { 0.154f, 0.179f }, { 0.692f, 0.718f }, { 0.821f, 0.846f }, { 0.692f, 0.718f } },
+			{ { 62.308f, 0.000f }, { 4.641f, 0.000f }, { 0.846f, 0.000f }, { 1.051f, 0.000f }, { 0.179f, 0.000f }, { 0.718f, 0.000f }, { 0.846f, 0.000f }, { 0.718f, 0.000f } },
+		},
+		{ // FilirStatRange50
+			{ { 0.000f, 57.959f }, { 0.000f, 4.367f }, { 0.000f, 0.571f }, { 0.000f, 0.816f }, { 0.000f, 0.041f }, { 0.000f, 0.469f }, { 0.000f, 0.571f }, { 0.000f, 0.469f } },
+			{ { 57.959f, 58.367f }, { 4.367f, 4.408f }, { 0.571f, 0.592f }, { 0.816f, 0.837f }, { 0.041f, 0.041f }, { 0.469f, 0.490f }, { 0.571f, 0.592f }, { 0.469f, 0.490f } },
+			{ { 58.367f, 58.776f }, { 4.408f, 4.449f }, { 0.592f, 0.633f }, { 0.837f, 0.857f }, { 0.041f, 0.061f }, { 0.490f, 0.531f }, { 0.592f, 0.633f }, { 0.490f, 0.531f } },
+			{ { 58.776f, 59.592f }, { 4.449f, 4.490f }, { 0.633f, 0.694f }, { 0.857f, 0.898f }, { 0.061f, 0.082f }, { 0.531f, 0.571f }, { 0.633f, 0.694f }, { 0.531f, 0.571f } },
+			{ { 59.592f, 60.204f }, { 4.490f, 4.510f }, { 0.694f, 0.735f }, { 0.898f, 0.939f }, { 0.082f, 0.102f }, { 0.571f, 0.612f }, { 0.694f, 0.735f }, { 0.571f, 0.612f } },
+			{ { 60.204f, 61.020f }, { 4.510f, 4.551f }, { 0.735f, 0.776f }, { 0.939f, 0.980f }, { 0.102f, 0.143f }, { 0.612f, 0.653f }, { 0.735f, 0.776f }, { 0.612f, 0.653f } },
+			{ { 61.020f, 61.633f }, { 4.551f, 4.592f }, { 0.776f, 0.816f }, { 0.980f, 1.000f }, { 0.143f, 0.163f }, { 0.653f, 0.673f }, { 0.776f, 0.816f }, { 0.653f, 0.673f } },
+			{ { 61.633f, 62.041f }, { 4.592f, 4.633f }, { 0.816f, 0.837f }, { 1.000f, 1.041f }, { 0.163f, 0.163f }, { 0.673f, 0.694f }, { 0.816f, 0.837f }, { 0.673f, 0.694f } },
+			{ { 62.041f, 0.000f }, { 4.633f, 0.000f }, { 0.837f, 0.000f }, { 1.041f, 0.000f }, { 0.163f, 0.000f }, { 0.694f, 0.000f }, { 0.837f, 0.000f }, { 0.694f, 0.000f } },
+		},
+		{ // FilirStatRange60
+			{ { 0.000f, 58.136f }, { 0.000f, 4.407f }, { 0.000f, 0.576f }, { 0.000f, 0.831f }, { 0.000f, 0.034f }, { 0.000f, 0.475f }, { 0.000f, 0.593f }, { 0.000f, 0.475f } },
+			{ { 58.136f, 58.475f }, { 4.407f, 4.424f }, { 0.576f, 0.610f }, { 0.831f, 0.847f }, { 0.034f, 0.051f }, { 0.475f, 0.508f }, { 0.593f, 0.610f }, { 0.475f, 0.508f } },
+			{ { 58.475f, 58.983f }, { 4.424f, 4.458f }, { 0.610f, 0.644f }, { 0.847f, 0.864f }, { 0.051f, 0.068f }, { 0.508f, 0.525f }, { 0.610f, 0.644f }, { 0.508f, 0.542f } },
+			{ { 58.983f, 59.661f }, { 4.458f, 4.492f }, { 0.644f, 0.695f }, { 0.864f, 0.915f }, { 0.068f, 0.085f }, { 0.525f, 0.576f }, { 0.644f, 0.678f }, { 0.542f, 0.576f } },
+			{ { 59.661f, 60.169f }, { 4.492f, 4.508f }, { 0.695f, 0.729f }, { 0.915f, 0.932f }, { 0.085f, 0.102f }, { 0.576f, 0.610f }, { 0.678f, 0.729f }, { 0.576f, 0.610f } },
+			{ { 60.169f, 60.847f }, { 4.508f, 4.542f }, { 0.729f, 0.763f }, { 0.932f, 0.983f }, { 0.102f, 0.136f }, { 0.610f, 0.644f }, { 0.729f, 0.763f }, { 0.610f, 0.644f } },
+			{ { 60.847f, 61.356f }, { 4.542f, 4.576f }, { 0.763f, 0.797f }, { 0.983f, 1.000f }, { 0.136f, 0.153f }, { 0.644f, 0.678f }, { 0.763f, 0.797f }, { 0.644f, 0.678f } },
+			{ { 61.356f, 61.864f }, { 4.576f, 4.593f }, { 0.797f, 0.831f }, { 1.000f, 1.017f }, { 0.153f, 0.169f }, { 0.678f, 0.695f }, { 0.797f, 0.831f }, { 0.678f, 0.695f } },
+			{ { 61.864f, 0.000f }, { 4.593f, 0.000f }, { 0.831f, 0.000f }, { 1.017f, 0.000f }, { 0.169f, 0.000f }, { 0.695f, 0.000f }, { 0.831f, 0.000f }, { 0.695f, 0.000f } },
+		},
+		{ // FilirStatRange70
+			{ { 0.000f, 58.261f }, { 0.000f, 4.420f }, { 0.000f, 0.594f }, { 0.000f, 0.826f }, { 0.000f, 0.043f }, { 0.000f, 0.493f }, { 0.000f, 0.594f }, { 0.000f, 0.493f } },
+			{ { 58.261f, 58.551f }, { 4.420f, 4.435f }, { 0.594f, 0.623f }, { 0.826f, 0.855f }, { 0.043f, 0.058f }, { 0.493f, 0.507f }, { 0.594f, 0.623f }, { 0.493f, 0.507f } },
+			{ { 58.551f, 58.986f }, { 4.435f, 4.464f }, { 0.623f, 0.652f }, { 0.855f, 0.870f }, { 0.058f, 0.072f }, { 0.507f, 0.536f }, { 0.623f, 0.652f }, { 0.507f, 0.536f } },
+			{ { 58.986f, 59.710f }, { 4.464f, 4.493f }, { 0.652f, 0.681f }, { 0.870f, 0.913f }, { 0.072f, 0.087f }, { 0.536f, 0.580f }, { 0.652f, 0.681f }, { 0.536f, 0.580f } },
+			{ { 59.710f, 60.145f }, { 4.493f, 4.507f }, { 0.681f, 0.725f }, { 0.913f, 0.942f }, { 0.087f, 0.101f }, { 0.580f, 0.609f }, { 0.681f, 0.725f }, { 0.580f, 0.609f } },
+			{ { 60.145f, 60.870f }, { 4.507f, 4.536f }, { 0.725f, 0.768f }, { 0.942f, 0.971f }, { 0.101f, 0.130f }, { 0.609f, 0.638f }, { 0.725f, 0.768f }, { 0.609f, 0.638f } },
+			{ { 60.870f, 61.304f }, { 4.536f, 4.565f }, { 0.768f, 0.797f }, { 0.971f, 1.000f }, { 0.130f, 0.145f }, { 0.638f, 0.667f }, { 0.768f, 0.797f }, { 0.638f, 0.667f } },
+			{ { 61.304f, 61.739f }, { 4.565f, 4.580f }, { 0.797f, 0.826f }, { 1.000f, 1.014f }, { 0.145f, 0.159f }, { 0.667f, 0.681f }, { 0.797f, 0.826f }, { 0.667f, 0.681f } },
+			{ { 61.739f, 0.000f }, { 4.580f, 0.000f }, { 0.826f, 0.000f }, { 1.014f, 0.000f }, { 0.159f, 0.000f }, { 0.681f, 0.000f }, { 0.826f, 0.000f }, { 0.681f, 0.000f } },
+		},
+		{ // FilirStatRange80
+			{ { 0.000f, 58.354f }, { 0.000f, 4.405f }, { 0.000f, 0.595f }, { 0.000f, 0.835f }, { 0.000f, 0.051f }, { 0.000f, 0.494f }, { 0.000f, 0.608f }, { 0.000f, 0.494f } },
+			{ { 58.354f, 58.608f }, { 4.405f, 4.443f }, { 0.595f, 0.620f }, { 0.835f, 0.861f }, { 0.051f, 0.063f }, { 0.494f, 0.519f }, { 0.608f, 0.620f }, { 0.494f, 0.519f } },
+			{ { 58.608f, 59.114f }, { 4.443f, 4.468f }, { 0.620f, 0.646f }, { 0.861f, 0.873f }, { 0.063f, 0.076f }, { 0.519f, 0.544f }, { 0.620f, 0.646f }, { 0.519f, 0.544f } },
+			{ { 59.114f, 59.620f }, { 4.468f, 4.494f }, { 0.646f, 0.684f }, { 0.873f, 0.911f }, { 0.076f, 0.089f }, { 0.544f, 0.570f }, { 0.646f, 0.684f }, { 0.544f, 0.570f } },
+			{ { 59.620f, 60.127f }, { 4.494f, 4.506f }, { 0.684f, 0.722f }, { 0.911f, 0.937f }, { 0.089f, 0.101f }, { 0.570f, 0.608f }, { 0.684f, 0.722f }, { 0.570f, 0.608f } },
+			{ { 60.127f, 60.759f }, { 4.506f, 4.532f }, { 0.722f, 0.759f }, { 0.937f, 0.962f }, { 0.101f, 0.127f }, { 0.608f, 0.633f }, { 0.722f, 0.759f }, { 0.608f, 0.633f } },
+			{ { 60.759f, 61.266f }, { 4.532f, 4.557f }, { 0.759f, 0.785f }, { 0.962f, 0.987f }, { 0.127f, 0.139f }, { 0.633f, 0.658f }, { 0.759f, 0.785f }, { 0.633f, 0.658f } },
+			{ { 61.266f, 61.646f }, { 4.557f, 4.595f }, { 0.785f, 0.810f }, { 0.987f, 1.013f }, { 0.139f, 0.152f }, { 0.658f, 0.684f }, { 0.785f, 0.810f }, { 0.658f, 0.684f } },
+			{ { 61.646f, 0.000f }, { 4.595f, 0.000f }, { 0.810f, 0.000f }, { 1.013f, 0.000f }, { 0.152f, 0.000f }, { 0.684f, 0.000f }, { 0.810f, 0.000f }, { 0.684f, 0.000f } },
+		},
+		{ // FilirStatRange90
+			{ { 0.000f, 58.427f }, { 0.000f, 4.427f }, { 0.000f, 0.607f }, { 0.000f, 0.843f }, { 0.000f, 0.056f }, { 0.000f, 0.506f }, { 0.000f, 0.607f }, { 0.000f, 0.506f } },
+			{ { 58.427f, 58.764f }, { 4.427f, 4.449f }, { 0.607f, 0.629f }, { 0.843f, 0.854f }, { 0.056f, 0.056f }, { 0.506f, 0.517f }, { 0.607f, 0.629f }, { 0.506f, 0.517f } },
+			{ { 58.764f, 59.101f }, { 4.449f, 4.472f }, { 0.629f, 0.652f }, { 0.854f, 0.876f }, { 0.056f, 0.079f }, { 0.517f, 0.539f }, { 0.629f, 0.652f }, { 0.517f, 0.539f } },
+			{ { 59.101f, 59.663f }, { 4.472f, 4.494f }, { 0.652f, 0.685f }, { 0.876f, 0.910f }, { 0.079f, 0.090f }, { 0.539f, 0.573f }, { 0.652f, 0.685f }, { 0.539f, 0.573f } },
+			{ { 59.663f, 60.225f }, { 4.494f, 4.506f }, { 0.685f, 0.719f }, { 0.910f, 0.933f }, { 0.090f, 0.112f }, { 0.573f, 0.607f }, { 0.685f, 0.719f }, { 0.573f, 0.607f } },
+			{ { 60.225f, 60.787f }, { 4.506f, 4.528f }, { 0.719f, 0.753f }, { 0.933f, 0.966f }, { 0.112f, 0.124f }, { 0.607f, 0.629f }, { 0.719f, 0.753f }, { 0.607f, 0.629f } },
+			{ { 60.787f, 61.124f }, { 4.528f, 4.551f }, { 0.753f, 0.787f }, { 0.966f, 0.989f }, { 0.124f, 0.146f }, { 0.629f, 0.652f }, { 0.753f, 0.787f }, { 0.629f, 0.652f } },
+			{ { 61.124f, 61.573f }, { 4.551f, 4.573f }, { 0.787f, 0.809f }, { 0.989f, 1.011f }, { 0.146f, 0.157f }, { 0.652f, 0.674f }, { 0.787f, 0.809f }, { 0.652f, 0.674f } },
+			{ { 61.573f, 0.000f }, { 4.573f, 0.000f }, { 0.809f, 0.000f }, { 1.011f, 0.000f }, { 0.157f, 0.000f }, { 0.674f, 0.000f }, { 0.809f, 0.000f }, { 0.674f, 0.000f } },
+		},
+		{ // FilirStatRange99
+			{ { 0.000f, 58.469f }, { 0.000f, 4.439f }, { 0.000f, 0.612f }, { 0.000f, 0.847f }, { 0.000f, 0.051f }, { 0.000f, 0.510f }, { 0.000f, 0.612f }, { 0.000f, 0.510f } },
+			{ { 58.469f, 58.776f }, { 4.439f, 4.449f }, { 0.612f, 0.633f }, { 0.847f, 0.857f }, { 0.051f, 0.061f }, { 0.510f, 0.520f }, { 0.612f, 0.633f }, { 0.510f, 0.520f } },
+			{ { 58.776f, 59.184f }, { 4.449f, 4.469f }, { 0.633f, 0.653f }, { 0.857f, 0.888f }, { 0.061f, 0.071f }, { 0.520f, 0.541f }, { 0.633f, 0.653f }, { 0.520f, 0.551f } },
+			{ { 59.184f, 59.694f }, { 4.469f, 4.490f }, { 0.653f, 0.694f }, { 0.888f, 0.908f }, { 0.071f, 0.092f }, { 0.541f, 0.571f }, { 0.653f, 0.694f }, { 0.551f, 0.571f } },
+			{ { 59.694f, 60.204f }, { 4.490f, 4.510f }, { 0.694f, 0.724f }, { 0.908f, 0.939f }, { 0.092f, 0.102f }, { 0.571f, 0.602f }, { 0.694f, 0.724f }, { 0.571f, 0.602f } },
+			{ { 60.204f, 60.714f }, { 4.510f, 4.531f }, { 0.724f, 0.755f }, { 0.939f, 0.959f }, { 0.102f, 0.122f }, { 0.602f, 0.633f }, { 0.724f, 0.755f }, { 0.602f, 0.633f } },
+			{ { 60.714f, 61.122f }, { 4.531f, 4.551f }, { 0.755f, 0.776f }, { 0.959f, 0.980f }, { 0.122f, 0.143f }, { 0.633f, 0.653f }, { 0.755f, 0.776f }, { 0.633f, 0.653f } },
+			{ { 61.122f, 61.429f }, { 4.551f, 4.561f }, { 0.776f, 0.796f }, { 0.980f, 1.000f }, { 0.143f, 0.153f }, { 0.653f, 0.673f }, { 0.776f, 0.796f }, { 0.653f, 0.673f } },
+			{ { 61.429f, 0.000f }, { 4.561f, 0.000f }, { 0.796f, 0.000f }, { 1.000f, 0.000f }, { 0.153f, 0.000f }, { 0.673f, 0.000f }, { 0.796f, 0.000f }, { 0.673f, 0.000f } },
+		},
+	},
+	{ // Amistr
+		{ // AmistrStatRange10
+			{ { 0.000f, 96.667f }, { 0.000f, 2.000f }, { 0.000f, 0.667f }, { 0.000f, 0.444f }, { 0.000f, 0.444f }, { 0.000f, 0.000f }, { 0.000f, 0.333f }, { 0.000f, 0.333f } },
+			{ { 96.667f, 97.778f }, { 2.000f, 2.111f }, { 0.667f, 0.778f }, { 0.444f, 0.444f }, { 0.444f, 0.444f }, { 0.000f, 0.000f }, { 0.333f, 0.333f }, { 0.333f, 0.333f } },
+			{ { 97.778f, 100.000f }, { 2.111f, 2.333f }, { 0.778f, 0.778f }, { 0.444f, 0.556f }, { 0.444f, 0.556f }, { 0.000f, 0.000f }, { 0.333f, 0.444f }, { 0.333f, 0.444f } },
+			{ { 100.000f, 103.333f }, { 2.333f, 2.444f }, { 0.778f, 0.889f }, { 0.556f, 0.667f }, { 0.556f, 0.667f }, { 0.000f, 0.111f }, { 0.444f, 0.556f }, { 0.444f, 0.556f } },
+			{ { 103.333f, 105.556f }, { 2.444f, 2.556f }, { 0.889f, 1.000f }, { 0.667f, 0.778f }, { 0.667f, 0.778f }, { 0.111f, 0.111f }, { 0.556f, 0.667f }, { 0.556f, 0.667f } },
+			{ { 105.556f, 108.889f }, { 2.556f, 2.667f }, { 1.000f, 1.000f }, { 0.778f, 0.889f }, { 0.778f, 0.889f }, { 0.111f, 0.222f }, { 0.667f, 0.778f }, { 0.667f, 0.778f } },
+			{ { 108.889f, 111.111f }, { 2.667f, 2.889f }, { 1.000f, 1.111f }, { 0.889f, 1.000f }, { 0.889f, 1.000f }, { 0.222f, 0.222f }, { 0.778f, 0.778f }, { 0.778f, 0.778f } },
+			{ { 111.111f, 112.222f }, { 2.889f, 3.000f }, { 1.111f, 1.222f }, { 1.000f, 1.000f }, { 1.000f, 1.000f }, { 0.222f, 0.333f }, { 0.778f, 0.889f }, { 0.778f, 0.889f } },
+			{ { 112.222f, 0.000f }, { 3.000f, 0.000f }, { 1.222f, 0.000f }, { 1.000f, 0.000f }, { 1.000f, 0.000f }, { 0.333f, 0.000f }, { 0.889f, 0.000f }, { 0.889f, 0.000f } },
+		},
+		{ // AmistrStatRange20
+			{ { 0.000f, 98.947f }, { 0.000f, 2.211f }, { 0.000f, 0.737f }, { 0.000f, 0.474f }, { 0.000f, 0.474f }, { 0.000f, 0.000f }, { 0.000f, 0.421f }, { 0.000f, 0.421f } },
+			{ { 98.947f, 100.526f }, { 2.211f, 2.316f }, { 0.737f, 0.789f }, { 0.474f, 0.526f }, { 0.474f, 0.526f }, { 0.000f, 0.000f }, { 0.421f, 0.421f }, { 0.421f, 0.421f } },
+			{ { 100.526f, 102.105f }, { 2.316f, 2.368f }, { 0.789f, 0.842f }, { 0.526f, 0.579f }, { 0.526f, 0.579f }, { 0.000f, 0.053f }, { 0.421f, 0.474f }, { 0.421f, 0.474f } },
+			{ { 102.105f, 103.684f }, { 2.368f, 2.474f }, { 0.842f, 0.895f }, { 0.579f, 0.684f }, { 0.579f, 0.684f }, { 0.053f, 0.053f }, { 0.474f, 0.579f }, { 0.474f, 0.579f } },
+			{ { 103.684f, 105.789f }, { 2.474f, 2.526f }, { 0.895f, 0.947f }, { 0.684f, 0.737f }, { 0.684f, 0.737f }, { 0.053f, 0.105f }, { 0.579f, 0.632f }, { 0.579f, 0.632f } },
+			{ { 105.789f, 107.368f }, { 2.526f, 2.632f }, { 0.947f, 1.000f }, { 0.737f, 0.789f }, { 0.737f, 0.789f }, { 0.105f, 0.158f }, { 0.632f, 0.684f }, { 0.632f, 0.684f } },
+			{ { 107.368f, 108.947f }, { 2.632f, 2.684f }, { 1.000f, 1.053f }, { 0.789f, 0.895f }, { 0.789f, 0.895f }, { 0.158f, 0.211f }, { 0.684f, 0.737f }, { 0.684f, 0.737f } },
+			{ { 108.947f, 110.526f }, { 2.684f, 2.789f }, { 1.053f, 1.105f }, { 0.895f, 0.895f }, { 0.895f, 0.895f }, { 0.211f, 0.211f }, { 0.737f, 0.789f }, { 0.737f, 0.789f } },
+			{ { 110.526f, 0.000f }, { 2.789f, 0.000f }, { 1.105f, 0.000f }, { 0.895f, 0.000f }, { 0.895f, 0.000f }, { 0.211f, 0.000f }, { 0.789f, 0.000f }, { 0.789f, 0.000f } },
+		},
+		{ // AmistrStatRange30
+			{ { 0.000f, 100.345f }, { 0.000f, 2.345f }, { 0.000f, 0.793f }, { 0.000f, 0.517f }, { 0.000f, 0.517f }, { 0.000f, 0.034f }, { 0.000f, 0.448f }, { 0.000f, 0.448f } },
+			{ { 100.345f, 101.379f }, { 2.345f, 2.379f }, { 0.793f, 0.828f }, { 0.517f, 0.586f }, { 0.517f, 0.586f }, { 0.034f, 0.034f }, { 0.448f, 0.483f }, { 0.448f, 0.483f } },
+			{ { 101.379f, 102.414f }, { 2.379f, 2.414f }, { 0.828f, 0.862f }, { 0.586f, 0.621f }, { 0.586f, 0.621f }, { 0.034f, 0.069f }, { 0.483f, 0.517f }, { 0.483f, 0.517f } },
+			{ { 102.414f, 104.138f }, { 2.414f, 2.483f }, { 0.862f, 0.897f }, { 0.621f, 0.690f }, { 0.621f, 0.690f }, { 0.069f, 0.069f }, { 0.517f, 0.552f }, { 0.517f, 0.552f } },
+			{ { 104.138f, 105.517f }, { 2.483f, 2.517f }, { 0.897f, 0.931f }, { 0.690f, 0.724f }, { 0.690f, 0.724f }, { 0.069f, 0.103f }, { 0.552f, 0.621f }, { 0.552f, 0.621f } },
+			{ { 105.517f, 107.241f }, { 2.517f, 2.586f }, { 0.931f, 1.000f }, { 0.724f, 0.793f }, { 0.724f, 0.793f }, { 0.103f, 0.138f }, { 0.621f, 0.655f }, { 0.621f, 0.655f } },
+			{ { 107.241f, 108.276f }, { 2.586f, 2.621f }, { 1.000f, 1.034f }, { 0.793f, 0.828f }, { 0.793f, 0.828f }, { 0.138f, 0.172f }, { 0.655f, 0.690f }, { 0.655f, 0.690f } },
+			{ { 108.276f, 109.310f }, { 2.621f, 2.655f }, { 1.034f, 1.069f }, { 0.828f, 0.862f }, { 0.828f, 0.897f }, { 0.172f, 0.207f }, { 0.690f, 0.724f }, { 0.690f, 0.724f } },
+			{ { 109.310f, 0.000f }, { 2.655f, 0.000f }, { 1.069f, 0.000f }, { 0.862f, 0.000f }, { 0.897f, 0.000f }, { 0.207f, 0.000f }, { 0.724f, 0.000f }, { 0.724f, 0.000f } },
+		},
+		{ // AmistrStatRange40
+			{ { 0.000f, 101.026f }, { 0.000f, 2.359f }, { 0.000f, 0.795f }, { 0.000f, 0.564f }, { 0.000f, 0.564f }, { 0.000f, 0.026f }, { 0.000f, 0.462f }, { 0.000f, 0.462f } },
+			{ { 101.026f, 101.795f }, { 2.359f, 2.410f }, { 0.795f, 0.821f }, { 0.564f, 0.590f }, { 0.564f, 0.590f }, { 0.026f, 0.051f }, { 0.462f, 0.487f }, { 0.462f, 0.487f } },
+			{ { 101.795f, 102.821f }, { 2.410f, 2.436f }, { 0.821f, 0.872f }, { 0.590f, 0.641f }, { 0.590f, 0.641f }, { 0.051f, 0.051f }, { 0.487f, 0.513f }, { 0.487f, 0.513f } },
+			{ { 102.821f, 104.359f }, { 2.436f, 2.487f }, { 0.872f, 0.897f }, { 0.641f, 0.692f }, { 0.641f, 0.692f }, { 0.051f, 0.077f }, { 0.513f, 0.564f }, { 0.513f, 0.564f } },
+			{ { 104.359f, 105.385f }, { 2.487f, 2.513f }, { 0.897f, 0.949f }, { 0.692f, 0.718f }, { 0.692f, 0.718f }, { 0.077f, 0.103f }, { 0.564f, 0.615f }, { 0.564f, 0.615f } },
+			{ { 105.385f, 106.923f }, { 2.513f, 2.564f }, { 0.949f, 0.974f }, { 0.718f, 0.795f }, { 0.718f, 0.795f }, { 0.103f, 0.128f }, { 0.615f, 0.667f }, { 0.615f, 0.667f } },
+			{ { 106.923f, 107.949f }, { 2.564f, 2.590f }, { 0.974f, 1.026f }, { 0.795f, 0.821f }, { 0.795f, 0.821f }, { 0.128f, 0.154f }, { 0.667f, 0.692f }, { 0.667f, 0.692f } },
+			{ { 107.949f, 108.718f }, { 2.590f, 2.641f }, { 1.026f, 1.051f }, { 0.821f, 0.846f }, { 0.821f, 0.846f }, { 0.154f, 0.179f }, { 0.692f, 0.718f }, { 0.692f, 0.718f } },
+			{ { 108.718f, 0.000f }, { 2.641f, 0.000f }, { 1.051f, 0.000f }, { 0.846f, 0.000f }, { 0.846f, 0.000f }, { 0.179f, 0.000f }, { 0.718f, 0.000f }, { 0.718f, 0.000f } },
+		},
+		{ // AmistrStatRange50
+			{ { 0.000f, 101.429f }, { 0.000f, 2.367f }, { 0.000f, 0.816f }, { 0.000f, 0.571f }, { 0.000f, 0.571f }, { 0.000f, 0.041f }, { 0.000f, 0.469f }, { 0.000f, 0.469f } },
+			{ { 101.429f, 102.245f }, { 2.367f, 2.408f }, { 0.816f, 0.837f }, { 0.571f, 0.592f }, { 0.571f, 0.592f }, { 0.041f, 0.041f }, { 0.469f, 0.490f }, { 0.469f, 0.490f } },
+			{ { 102.245f, 103.061f }, { 2.408f, 2.449f }, { 0.837f, 0.857f }, { 0.592f, 0.633f }, { 0.592f, 0.633f }, { 0.041f, 0.061f }, { 0.490f, 0.531f }, { 0.490f, 0.531f } },
+			{ { 103.061f, 104.286f }, { 2.449f, 2.490f }, { 0.857f, 0.898f }, { 0.633f, 0.694f }, { 0.633f, 0.694f }, { 0.061f, 0.082f }, { 0.531f, 0.571f }, { 0.531f, 0.571f } },
+			{ { 104.286f, 105.510f }, { 2.490f, 2.510f }, { 0.898f, 0.939f }, { 0.694f, 0.735f }, { 0.694f, 0.735f }, { 0.082f, 0.102f }, { 0.571f, 0.612f }, { 0.571f, 0.612f } },
+			{ { 105.510f, 106.735f }, { 2.510f, 2.551f }, { 0.939f, 0.980f }, { 0.735f, 0.776f }, { 0.735f, 0.776f }, { 0.102f, 0.143f }, { 0.612f, 0.653f }, { 0.612f, 0.653f } },
+			{ { 106.735f, 107.551f }, { 2.551f, 2.592f }, { 0.980f, 1.000f }, { 0.776f, 0.816f }, { 0.776f, 0.816f }, { 0.143f, 0.163f }, { 0.653f, 0.673f }, { 0.653f, 0.673f } },
+			{ { 107.551f, 108.367f }, { 2.592f, 2.633f }, { 1.000f, 1.041f }, { 0.816f, 0.837f }, { 0.816f, 0.837f }, { 0.163f, 0.163f }, { 0.673f, 0.694f }, { 0.673f, 0.694f } },
+			{ { 108.367f, 0.000f }, { 2.633f, 0.000f }, { 1.041f, 0.000f }, { 0.837f, 0.000f }, { 0.837f, 0.000f }, { 0.163f, 0.000f }, { 0.694f, 0.000f }, { 0.694f, 0.000f } },
+		},
+		{ // AmistrStatRange60
+			{ { 0.000f, 101.695f }, { 0.000f, 2.407f }, { 0.000f, 0.814f }, { 0.000f, 0.576f }, { 0.000f, 0.593f }, { 0.000f, 0.034f }, { 0.000f, 0.475f }, { 0.000f, 0.475f } },
+			{ { 101.695f, 102.373f }, { 2.407f, 2.424f }, { 0.814f, 0.847f }, { 0.576f, 0.610f }, { 0.593f, 0.610f }, { 0.034f, 0.051f }, { 0.475f, 0.508f }, { 0.475f, 0.508f } },
+			{ { 102.373f, 103.220f }, { 2.424f, 2.458f }, { 0.847f, 0.864f }, { 0.610f, 0.644f }, { 0.610f, 0.644f }, { 0.051f, 0.068f }, { 0.508f, 0.542f }, { 0.508f, 0.542f } },
+			{ { 103.220f, 104.407f }, { 2.458f, 2.492f }, { 0.864f, 0.915f }, { 0.644f, 0.695f }, { 0.644f, 0.695f }, { 0.068f, 0.085f }, { 0.542f, 0.576f }, { 0.542f, 0.576f } },
+			{ { 104.407f, 105.424f }, { 2.492f, 2.508f }, { 0.915f, 0.932f }, { 0.695f, 0.729f }, { 0.695f, 0.729f }, { 0.085f, 0.102f }, { 0.576f, 0.610f }, { 0.576f, 0.610f } },
+			{ { 105.424f, 106.610f }, { 2.508f, 2.542f }, { 0.932f, 0.983f }, { 0.729f, 0.763f }, { 0.729f, 0.763f }, { 0.102f, 0.136f }, { 0.610f, 0.644f }, { 0.610f, 0.644f } },
+			{ { 106.610f, 107.458f }, { 2.542f, 2.576f }, { 0.983f, 1.000f }, { 0.763f, 0.797f }, { 0.763f, 0.797f }, { 0.136f, 0.153f }, { 0.644f, 0.678f }, { 0.644f, 0.678f } },
+			{ { 107.458f, 108.136f }, { 2.576f, 2.593f }, { 1.000f, 1.017f }, { 0.797f, 0.831f }, { 0.797f, 0.831f }, { 0.153f, 0.169f }, { 0.678f, 0.695f }, { 0.678f, 0.695f } },
+			{ { 108.136f, 0.000f }, { 2.593f, 0.000f }, { 1.017f, 0.000f }, { 0.831f, 0.000f }, { 0.831f, 0.000f }, { 0.169f, 0.000f }, { 0.695f, 0.000f }, { 0.695f, 0.000f } },
+		},
+		{ // AmistrStatRange70
+			{ { 0.000f, 102.029f }, { 0.000f, 2.420f }, { 0.000f, 0.826f }, { 0.000f, 0.594f }, { 0.000f, 0.594f }, { 0.000f, 0.043f }, { 0.000f, 0.493f }, { 0.000f, 0.493f } },
+			{ { 102.029f, 102.609f }, { 2.420f, 2.435f }, { 0.826f, 0.855f }, { 0.594f, 0.623f }, { 0.594f, 0.623f }, { 0.043f, 0.058f }, { 0.493f, 0.507f }, { 0.493f, 0.507f } },
+			{ { 102.609f, 103.478f }, { 2.435f, 2.464f }, { 0.855f, 0.870f }, { 0.623f, 0.652f }, { 0.623f, 0.652f }, { 0.058f, 0.072f }, { 0.507f, 0.536f }, { 0.507f, 0.536f } },
+			{ { 103.478f, 104.493f }, { 2.464f, 2.493f }, { 0.870f, 0.913f }, { 0.652f, 0.681f }, { 0.652f, 0.681f }, { 0.072f, 0.087f }, { 0.536f, 0.580f }, { 0.536f, 0.580f } },
+			{ { 104.493f, 105.362f }, { 2.493f, 2.507f }, { 0.913f, 0.942f }, { 0.681f, 0.725f }, { 0.681f, 0.725f }, { 0.087f, 0.101f }, { 0.580f, 0.609f }, { 0.580f, 0.609f } },
+			{ { 105.362f, 106.377f }, { 2.507f, 2.536f }, { 0.942f, 0.971f }, { 0.725f, 0.768f }, { 0.725f, 0.768f }, { 0.101f, 0.130f }, { 0.609f, 0.638f }, { 0.609f, 0.638f } },
+			{ { 106.377f, 107.246f }, { 2.536f, 2.565f }, { 0.971f, 1.000f }, { 0.768f, 0.797f }, { 0.768f, 0.797f }, { 0.130f, 0.145f }, { 0.638f, 0.667f }, { 0.638f, 0.667f } },
+			{ { 107.246f, 107.826f }, { 2.565f, 2.580f }, { 1.000f, 1.014f }, { 0.797f, 0.826f }, { 0.797f, 0.826f }, { 0.145f, 0.159f }, { 0.667f, 0.681f }, { 0.667f, 0.681f } },
+			{ { 107.826f, 0.000f }, { 2.580f, 0.000f }, { 1.014f, 0.000f }, { 0.826f, 0.000f }, { 0.826f, 0.000f }, { 0.159f, 0.000f }, { 0.681f, 0.000f }, { 0.681f, 0.000f } },
+		},
+		{ // AmistrStatRange80
+			{ { 0.000f, 102.152f }, { 0.000f, 2.405f }, { 0.000f, 0.835f }, { 0.000f, 0.595f }, { 0.000f, 0.608f }, { 0.000f, 0.051f }, { 0.000f, 0.494f }, { 0.000f, 0.494f } },
+			{ { 102.152f, 102.785f }, { 2.405f, 2.443f }, { 0.835f, 0.861f }, { 0.595f, 0.620f }, { 0.608f, 0.620f }, { 0.051f, 0.063f }, { 0.494f, 0.519f }, { 0.494f, 0.519f } },
+			{ { 102.785f, 103.544f }, { 2.443f, 2.468f }, { 0.861f, 0.873f }, { 0.620f, 0.646f }, { 0.620f, 0.646f }, { 0.063f, 0.076f }, { 0.519f, 0.544f }, { 0.519f, 0.544f } },
+			{ { 103.544f, 104.557f }, { 2.468f, 2.494f }, { 0.873f, 0.911f }, { 0.646f, 0.684f }, { 0.646f, 0.684f }, { 0.076f, 0.089f }, { 0.544f, 0.570f }, { 0.544f, 0.570f } },
+			{ { 104.557f, 105.316f }, { 2.494f, 2.506f }, { 0.911f, 0.937f }, { 0.684f, 0.722f }, { 0.684f, 0.722f }, { 0.089f, 0.101f }, { 0.570f, 0.608f }, { 0.570f, 0.608f } },
+			{ { 105.316f, 106.329f }, { 2.506f, 2.532f }, { 0.937f, 0.962f }, { 0.722f, 0.759f }, { 0.722f, 0.759f }, { 0.101f, 0.127f }, { 0.608f, 0.633f }, { 0.608f, 0.633f } },
+			{ { 106.329f, 107.089f }, { 2.532f, 2.557f }, { 0.962f, 0.987f }, { 0.759f, 0.785f }, { 0.759f, 0.785f }, { 0.127f, 0.139f }, { 0.633f, 0.658f }, { 0.633f, 0.658f } },
+			{ { 107.089f, 107.595f }, { 2.557f, 2.595f }, { 0.987f, 1.013f }, { 0.785f, 0.810f }, { 0.785f, 0.810f }, { 0.139f, 0.152f }, { 0.658f, 0.684f }, { 0.658f, 0.684f } },
+			{ { 107.595f, 0.000f }, { 2.595f, 0.000f }, { 1.013f, 0.000f }, { 0.810f, 0.000f }, { 0.810f, 0.000f }, { 0.152f, 0.000f }, { 0.684f, 0.000f }, { 0.684f, 0.000f } },
+		},
+		{ // AmistrStatRange90
+			{ { 0.000f, 102.360f }, { 0.000f, 2.427f }, { 0.000f, 0.843f }, { 0.000f, 0.607f }, { 0.000f, 0.607f }, { 0.000f, 0.056f }, { 0.000f, 0.506f }, { 0.000f, 0.506f } },
+			{ { 102.360f, 102.921f }, { 2.427f, 2.449f }, { 0.843f, 0.854f }, { 0.607f, 0.629f }, { 0.607f, 0.629f }, { 0.056f, 0.067f }, { 0.506f, 0.517f }, { 0.506f, 0.517f } },
+			{ { 102.921f, 103.596f }, { 2.449f, 2.472f }, { 0.854f, 0.876f }, { 0.629f, 0.652f }, { 0.629f, 0.652f }, { 0.067f, 0.079f }, { 0.517f, 0.539f }, { 0.517f, 0.539f } },
+			{ { 103.596f, 104.494f }, { 2.472f, 2.494f }, { 0.876f, 0.910f }, { 0.652f, 0.685f }, { 0.652f, 0.685f }, { 0.079f, 0.090f }, { 0.539f, 0.573f }, { 0.539f, 0.573f } },
+			{ { 104.494f, 105.393f }, { 2.494f, 2.506f }, { 0.910f, 0.933f }, { 0.685f, 0.719f }, { 0.685f, 0.719f }, { 0.090f, 0.101f }, { 0.573f, 0.607f }, { 0.573f, 0.607f } },
+			{ { 105.393f, 106.292f }, { 2.506f, 2.528f }, { 0.933f, 0.966f }, { 0.719f, 0.753f }, { 0.719f, 0.753f }, { 0.101f, 0.124f }, { 0.607f, 0.629f }, { 0.607f, 0.629f } },
+			{ { 106.292f, 106.966f }, { 2.528f, 2.551f }, { 0.966f, 0.989f }, { 0.753f, 0.787f }, { 0.753f, 0.787f }, { 0.124f, 0.135f }, { 0.629f, 0.652f }, { 0.629f, 0.652f } },
+			{ { 106.966f, 107.528f }, { 2.551f, 2.573f }, { 0.989f, 1.000f }, { 0.787f, 0.809f }, { 0.787f, 0.809f }, { 0.135f, 0.157f }, { 0.652f, 0.674f }, { 0.652f, 0.674f } },
+			{ { 107.528f, 0.000f }, { 2.573f, 0.000f }, { 1.000f, 0.000f }, { 0.809f, 0.000f }, { 0.809f, 0.000f }, { 0.157f, 0.000f }, { 0.674f, 0.000f }, { 0.674f, 0.000f } },
+		},
+		{ // AmistrStatRange99
+			{ { 0.000f, 102.449f }, { 0.000f, 2.439f }, { 0.000f, 0.847f }, { 0.000f, 0.612f }, { 0.000f, 0.612f }, { 0.000f, 0.051f }, { 0.000f, 0.510f }, { 0.000f, 0.510f } },
+			{ { 102.449f, 103.061f }, { 2.439f, 2.449f }, { 0.847f, 0.857f }, { 0.612f, 0.633f }, { 0.612f, 0.633f }, { 0.051f, 0.061f }, { 0.510f, 0.520f }, { 0.510f, 0.520f } },
+			{ { 103.061f, 103.673f }, { 2.449f, 2.469f }, { 0.857f, 0.888f }, { 0.633f, 0.653f }, { 0.633f, 0.653f }, { 0.061f, 0.071f }, { 0.520f, 0.551f }, { 0.520f, 0.551f } },
+			{ { 103.673f, 104.592f }, { 2.469f, 2.490f }, { 0.888f, 0.908f }, { 0.653f, 0.694f }, { 0.653f, 0.694f }, { 0.071f, 0.092f }, { 0.551f, 0.571f }, { 0.551f, 0.571f } },
+			{ { 104.592f, 105.306f }, { 2.490f, 2.510f }, { 0.908f, 0.939f }, { 0.694f, 0.724f }, { 0.694f, 0.724f }, { 0.092f, 0.102f }, { 0.571f, 0.602f }, { 0.571f, 0.602f } },
+			{ { 105.306f, 106.224f }, { 2.510f, 2.531f }, { 0.939f, 0.959f }, { 0.724f, 0.755f }, { 0.724f, 0.755f }, { 0.102f, 0.122f }, { 0.602f, 0.633f }, { 0.602f, 0.633f } },
+			{ { 106.224f, 106.837f }, { 2.531f, 2.551f }, { 0.959f, 0.980f }, { 0.755f, 0.776f }, { 0.755f, 0.776f }, { 0.122f, 0.143f }, { 0.633f, 0.653f }, { 0.633f, 0.653f } },
+			{ { 106.837f, 107.347f }, { 2.551f, 2.561f }, { 0.980f, 1.000f }, { 0.776f, 0.796f }, { 0.776f, 0.806f }, { 0.143f, 0.153f }, { 0.653f, 0.673f }, { 0.653f, 0.673f } },
+			{ { 107.347f, 0.000f }, { 2.561f, 0.000f }, { 1.000f, 0.000f }, { 0.796f, 0.000f }, { 0.806f, 0.000f }, { 0.153f, 0.000f }, { 0.673f, 0.000f }, { 0.673f, 0.000f } },
+		},
+	},
+	{ // Lif
+		{ // LifStatRange10
+			{ { 0.000f, 73.333f }, { 0.000f, 5.556f }, { 0.000f, 0.444f }, { 0.000f, 0.444f }, { 0.000f, 0.444f }, { 0.000f, 0.444f }, { 0.000f, 0.556f }, { 0.000f, 0.556f } },
+			{ { 73.333f, 74.444f }, { 5.556f, 5.778f }, { 0.444f, 0.444f }, { 0.444f, 0.444f }, { 0.444f, 0.444f }, { 0.444f, 0.444f }, { 0.556f, 0.556f }, { 0.556f, 0.556f } },
+			{ { 74.444f, 76.667f }, { 5.778f, 6.000f }, { 0.444f, 0.556f }, { 0.444f, 0.556f }, { 0.444f, 0.556f }, { 0.444f, 0.556f }, { 0.556f, 0.667f }, { 0.556f, 0.667f } },
+			{ { 76.667f, 78.889f }, { 6.000f, 6.333f }, { 0.556f, 0.667f }, { 0.556f, 0.667f }, { 0.556f, 0.667f }, { 0.556f, 0.667f }, { 0.667f, 0.778f }, { 0.667f, 0.778f } },
+			{ { 78.889f, 80.000f }, { 6.333f, 6.667f }, { 0.667f, 0.667f }, { 0.667f, 0.667f }, { 0.667f, 0.667f }, { 0.667f, 0.778f }, { 0.778f, 0.889f }, { 0.778f, 0.889f } },
+			{ { 80.000f, 83.333f }, { 6.667f, 7.000f }, { 0.667f, 0.778f }, { 0.667f, 0.778f }, { 0.667f, 0.778f }, { 0.778f, 0.889f }, { 0.889f, 1.000f }, { 0.889f, 1.000f } },
+			{ { 83.333f, 84.444f }, { 7.000f, 7.222f }, { 0.778f, 0.889f }, { 0.778f, 0.889f }, { 0.778f, 0.889f }, { 0.889f, 1.000f }, { 1.000f, 1.000f }, { 1.000f, 1.000f } },
+			{ { 84.444f, 85.556f }, { 7.222f, 7.444f }, { 0.889f, 0.889f }, { 0.889f, 0.889f }, { 0.889f, 0.889f }, { 1.000f, 1.000f }, { 1.000f, 1.111f }, { 1.000f, 1.111f } },
+			{ { 85.556f, 0.000f }, { 7.444f, 0.000f }, { 0.889f, 0.000f }, { 0.889f, 0.000f }, { 0.889f, 0.000f }, { 1.000f, 0.000f }, { 1.111f, 0.000f }, { 1.111f, 0.000f } },
+		},
+		{ // LifStatRange20
+			{ { 0.000f, 75.263f }, { 0.000f, 5.842f }, { 0.000f, 0.474f }, { 0.000f, 0.474f }, { 0.000f, 0.474f }, { 0.000f, 0.474f }, { 0.000f, 0.579f }, { 0.000f, 0.579f } },
+			{ { 75.263f, 76.316f }, { 5.842f, 6.000f }, { 0.474f, 0.526f }, { 0.474f, 0.526f }, { 0.474f, 0.526f }, { 0.474f, 0.526f }, { 0.579f, 0.632f }, { 0.579f, 0.632f } },
+			{ { 76.316f, 77.368f }, { 6.000f, 6.158f }, { 0.526f, 0.579f }, { 0.526f, 0.579f }, { 0.526f, 0.579f }, { 0.526f, 0.579f }, { 0.632f, 0.684f }, { 0.632f, 0.684f } },
+			{ { 77.368f, 78.947f }, { 6.158f, 6.421f }, { 0.579f, 0.632f }, { 0.579f, 0.632f }, { 0.579f, 0.632f }, { 0.579f, 0.684f }, { 0.684f, 0.789f }, { 0.684f, 0.789f } },
+			{ { 78.947f, 80.526f }, { 6.421f, 6.579f }, { 0.632f, 0.684f }, { 0.632f, 0.684f }, { 0.632f, 0.684f }, { 0.684f, 0.737f }, { 0.789f, 0.842f }, { 0.789f, 0.842f } },
+			{ { 80.526f, 82.105f }, { 6.579f, 6.842f }, { 0.684f, 0.737f }, { 0.684f, 0.737f }, { 0.684f, 0.737f }, { 0.737f, 0.789f }, { 0.842f, 0.895f }, { 0.842f, 0.895f } },
+			{ { 82.105f, 83.158f }, { 6.842f, 7.000f }, { 0.737f, 0.789f }, { 0.737f, 0.789f }, { 0.737f, 0.789f }, { 0.789f, 0.895f }, { 0.895f, 0.947f }, { 0.895f, 0.947f } },
+			{ { 83.158f, 84.211f }, { 7.000f, 7.158f }, { 0.789f, 0.842f }, { 0.789f, 0.842f }, { 0.789f, 0.842f }, { 0.895f, 0.895f }, { 0.947f, 1.000f }, { 0.947f, 1.000f } },
+			{ { 84.211f, 0.000f }, { 7.158f, 0.000f }, { 0.842f, 0.000f }, { 0.842f, 0.000f }, { 0.842f, 0.000f }, { 0.895f, 0.000f }, { 1.000f, 0.000f }, { 1.000f, 0.000f } },
+		},
+		{ // LifStatRange30
+			{ { 0.000f, 76.207f }, { 0.000f, 6.000f }, { 0.000f, 0.517f }, { 0.000f, 0.517f }, { 0.000f, 0.517f }, { 0.000f, 0.517f }, { 0.000f, 0.621f }, { 0.000f, 0.621f } },
+			{ { 76.207f, 76.897f }, { 6.000f, 6.103f }, { 0.517f, 0.552f }, { 0.517f, 0.552f }, { 0.517f, 0.552f }, { 0.517f, 0.586f }, { 0.621f, 0.655f }, { 0.621f, 0.655f } },
+			{ { 76.897f, 77.931f }, { 6.103f, 6.241f }, { 0.552f, 0.586f }, { 0.552f, 0.586f }, { 0.552f, 0.586f }, { 0.586f, 0.621f }, { 0.655f, 0.724f }, { 0.655f, 0.724f } },
+			{ { 77.931f, 79.310f }, { 6.241f, 6.414f }, { 0.586f, 0.655f }, { 0.586f, 0.655f }, { 0.586f, 0.655f }, { 0.621f, 0.690f }, { 0.724f, 0.759f }, { 0.724f, 0.759f } },
+			{ { 79.310f, 80.345f }, { 6.414f, 6.586f }, { 0.655f, 0.690f }, { 0.655f, 0.690f }, { 0.655f, 0.690f }, { 0.690f, 0.724f }, { 0.759f, 0.828f }, { 0.759f, 0.828f } },
+			{ { 80.345f, 81.724f }, { 6.586f, 6.759f }, { 0.690f, 0.724f }, { 0.690f, 0.724f }, { 0.690f, 0.724f }, { 0.724f, 0.793f }, { 0.828f, 0.897f }, { 0.828f, 0.897f } },
+			{ { 81.724f, 82.759f }, { 6.759f, 6.897f }, { 0.724f, 0.793f }, { 0.724f, 0.793f }, { 0.724f, 0.793f }, { 0.793f, 0.828f }, { 0.897f, 0.931f }, { 0.897f, 0.931f } },
+			{ { 82.759f, 83.448f }, { 6.897f, 7.000f }, { 0.793f, 0.793f }, { 0.793f, 0.793f }, { 0.793f, 0.793f }, { 0.828f, 0.862f }, { 0.931f, 0.966f }, { 0.931f, 0.966f } },
+			{ { 83.448f, 0.000f }, { 7.000f, 0.000f }, { 0.793f, 0.000f }, { 0.793f, 0.000f }, { 0.793f, 0.000f }, { 0.862f, 0.000f }, { 0.966f, 0.000f }, { 0.966f, 0.000f } },
+		},
+		{ // LifStatRange40
+			{ { 0.000f, 76.667f }, { 0.000f, 6.051f }, { 0.000f, 0.538f }, { 0.000f, 0.538f }, { 0.000f, 0.538f }, { 0.000f, 0.564f }, { 0.000f, 0.667f }, { 0.000f, 0.667f } },
+			{ { 76.667f, 77.436f }, { 6.051f, 6.154f }, { 0.538f, 0.564f }, { 0.538f, 0.564f }, { 0.538f, 0.564f }, { 0.564f, 0.590f }, { 0.667f, 0.692f }, { 0.667f, 0.692f } },
+			{ { 77.436f, 78.205f }, { 6.154f, 6.282f }, { 0.564f, 0.615f }, { 0.564f, 0.615f }, { 0.564f, 0.615f }, { 0.590f, 0.641f }, { 0.692f, 0.718f }, { 0.692f, 0.718f } },
+			{ { 78.205f, 79.487f }, { 6.282f, 6.436f }, { 0.615f, 0.641f }, { 0.615f, 0.641f }, { 0.615f, 0.641f }, { 0.641f, 0.692f }, { 0.718f, 0.769f }, { 0.718f, 0.769f } },
+			{ { 79.487f, 80.256f }, { 6.436f, 6.564f }, { 0.641f, 0.692f }, { 0.641f, 0.692f }, { 0.641f, 0.692f }, { 0.692f, 0.718f }, { 0.769f, 0.821f }, { 0.769f, 0.821f } },
+			{ { 80.256f, 81.538f }, { 6.564f, 6.718f }, { 0.692f, 0.718f }, { 0.692f, 0.718f }, { 0.692f, 0.718f }, { 0.718f, 0.795f }, { 0.821f, 0.872f }, { 0.821f, 0.872f } },
+			{ { 81.538f, 82.308f }, { 6.718f, 6.846f }, { 0.718f, 0.769f }, { 0.718f, 0.769f }, { 0.718f, 0.769f }, { 0.795f, 0.821f }, { 0.872f, 0.923f }, { 0.872f, 0.897f } },
+			{ { 82.308f, 83.077f }, { 6.846f, 6.949f }, { 0.769f, 0.795f }, { 0.769f, 0.795f }, { 0.769f, 0.795f }, { 0.821f, 0.846f }, { 0.923f, 0.949f }, { 0.897f, 0.949f } },
+			{ { 83.077f, 0.000f }, { 6.949f, 0.000f }, { 0.795f, 0.000f }, { 0.795f, 0.000f }, { 0.795f, 0.000f }, { 0.846f, 0.000f }, { 0.949f, 0.000f }, { 0.949f, 0.000f } },
+		},
+		{ // LifStatRange50
+			{ { 0.000f, 77.143f }, { 0.000f, 6.102f }, { 0.000f, 0.551f }, { 0.000f, 0.551f }, { 0.000f, 0.551f }, { 0.000f, 0.571f }, { 0.000f, 0.673f }, { 0.000f, 0.673f } },
+			{ { 77.143f, 77.755f }, { 6.102f, 6.204f }, { 0.551f, 0.571f }, { 0.551f, 0.571f }, { 0.551f, 0.571f }, { 0.571f, 0.592f }, { 0.673f, 0.694f }, { 0.673f, 0.694f } },
+			{ { 77.755f, 78.571f }, { 6.204f, 6.306f }, { 0.571f, 0.612f }, { 0.571f, 0.612f }, { 0.571f, 0.612f }, { 0.592f, 0.633f }, { 0.694f, 0.735f }, { 0.694f, 0.735f } },
+			{ { 78.571f, 79.592f }, { 6.306f, 6.449f }, { 0.612f, 0.653f }, { 0.612f, 0.653f }, { 0.612f, 0.653f }, { 0.633f, 0.694f }, { 0.735f, 0.776f }, { 0.735f, 0.776f } },
+			{ { 79.592f, 80.408f }, { 6.449f, 6.551f }, { 0.653f, 0.694f }, { 0.653f, 0.694f }, { 0.653f, 0.694f }, { 0.694f, 0.735f }, { 0.776f, 0.816f }, { 0.776f, 0.816f } },
+			{ { 80.408f, 81.429f }, { 6.551f, 6.694f }, { 0.694f, 0.714f }, { 0.694f, 0.714f }, { 0.694f, 0.714f }, { 0.735f, 0.776f }, { 0.816f, 0.857f }, { 0.816f, 0.857f } },
+			{ { 81.429f, 82.041f }, { 6.694f, 6.796f }, { 0.714f, 0.755f }, { 0.714f, 0.755f }, { 0.714f, 0.755f }, { 0.776f, 0.816f }, { 0.857f, 0.898f }, { 0.857f, 0.898f } },
+			{ { 82.041f, 82.653f }, { 6.796f, 6.878f }, { 0.755f, 0.776f }, { 0.755f, 0.776f }, { 0.755f, 0.776f }, { 0.816f, 0.837f }, { 0.898f, 0.918f }, { 0.898f, 0.918f } },
+			{ { 82.653f, 0.000f }, { 6.878f, 0.000f }, { 0.776f, 0.000f }, { 0.776f, 0.000f }, { 0.776f, 0.000f }, { 0.837f, 0.000f }, { 0.918f, 0.000f }, { 0.918f, 0.000f } },
+		},
+		{ // LifStatRange60
+			{ { 0.000f, 77.288f }, { 0.000f, 6.153f }, { 0.000f, 0.559f }, { 0.000f, 0.559f }, { 0.000f, 0.559f }, { 0.000f, 0.593f }, { 0.000f, 0.678f }, { 0.000f, 0.678f } },
+			{ { 77.288f, 77.966f }, { 6.153f, 6.220f }, { 0.559f, 0.593f }, { 0.559f, 0.593f }, { 0.559f, 0.593f }, { 0.593f, 0.610f }, { 0.678f, 0.712f }, { 0.678f, 0.712f } },
+			{ { 77.966f, 78.644f }, { 6.220f, 6.322f }, { 0.593f, 0.610f }, { 0.593f, 0.610f }, { 0.593f, 0.610f }, { 0.610f, 0.644f }, { 0.712f, 0.746f }, { 0.712f, 0.746f } },
+			{ { 78.644f, 79.492f }, { 6.322f, 6.441f }, { 0.610f, 0.644f }, { 0.610f, 0.644f }, { 0.610f, 0.644f }, { 0.644f, 0.678f }, { 0.746f, 0.780f }, { 0.746f, 0.780f } },
+			{ { 79.492f, 80.339f }, { 6.441f, 6.559f }, { 0.644f, 0.678f }, { 0.644f, 0.678f }, { 0.644f, 0.678f }, { 0.678f, 0.729f }, { 0.780f, 0.814f }, { 0.780f, 0.814f } },
+			{ { 80.339f, 81.186f }, { 6.559f, 6.678f }, { 0.678f, 0.712f }, { 0.678f, 0.712f }, { 0.678f, 0.712f }, { 0.729f, 0.763f }, { 0.814f, 0.864f }, { 0.814f, 0.864f } },
+			{ { 81.186f, 81.864f }, { 6.678f, 6.780f }, { 0.712f, 0.746f }, { 0.712f, 0.746f }, { 0.712f, 0.746f }, { 0.763f, 0.797f }, { 0.864f, 0.898f }, { 0.864f, 0.881f } },
+			{ { 81.864f, 82.373f }, { 6.780f, 6.847f }, { 0.746f, 0.763f }, { 0.746f, 0.763f }, { 0.746f, 0.763f }, { 0.797f, 0.831f }, { 0.898f, 0.915f }, { 0.881f, 0.915f } },
+			{ { 82.373f, 0.000f }, { 6.847f, 0.000f }, { 0.763f, 0.000f }, { 0.763f, 0.000f }, { 0.763f, 0.000f }, { 0.831f, 0.000f }, { 0.915f, 0.000f }, { 0.915f, 0.000f } },
+		},
+		{ // LifStatRange70
+			{ { 0.000f, 77.536f }, { 0.000f, 6.174f }, { 0.000f, 0.565f }, { 0.000f, 0.580f }, { 0.000f, 0.565f }, { 0.000f, 0.594f }, { 0.000f, 0.696f }, { 0.000f, 0.696f } },
+			{ { 77.536f, 78.116f }, { 6.174f, 6.246f }, { 0.565f, 0.594f }, { 0.580f, 0.594f }, { 0.565f, 0.594f }, { 0.594f, 0.623f }, { 0.696f, 0.710f }, { 0.696f, 0.710f } },
+			{ { 78.116f, 78.696f }, { 6.246f, 6.333f }, { 0.594f, 0.623f }, { 0.594f, 0.623f }, { 0.594f, 0.623f }, { 0.623f, 0.652f }, { 0.710f, 0.739f }, { 0.710f, 0.739f } },
+			{ { 78.696f, 79.565f }, { 6.333f, 6.449f }, { 0.623f, 0.652f }, { 0.623f, 0.652f }, { 0.623f, 0.652f }, { 0.652f, 0.681f }, { 0.739f, 0.783f }, { 0.739f, 0.783f } },
+			{ { 79.565f, 80.290f }, { 6.449f, 6.551f }, { 0.652f, 0.681f }, { 0.652f, 0.681f }, { 0.652f, 0.681f }, { 0.681f, 0.725f }, { 0.783f, 0.812f }, { 0.783f, 0.812f } },
+			{ { 80.290f, 81.159f }, { 6.551f, 6.667f }, { 0.681f, 0.710f }, { 0.681f, 0.710f }, { 0.681f, 0.710f }, { 0.725f, 0.768f }, { 0.812f, 0.855f }, { 0.812f, 0.855f } },
+			{ { 81.159f, 81.739f }, { 6.667f, 6.754f }, { 0.710f, 0.739f }, { 0.710f, 0.739f }, { 0.710f, 0.739f }, { 0.768f, 0.797f }, { 0.855f, 0.884f }, { 0.855f, 0.884f } },
+			{ { 81.739f, 82.174f }, { 6.754f, 6.826f }, { 0.739f, 0.754f }, { 0.739f, 0.754f }, { 0.739f, 0.754f }, { 0.797f, 0.826f }, { 0.884f, 0.913f }, { 0.884f, 0.913f } },
+			{ { 82.174f, 0.000f }, { 6.826f, 0.000f }, { 0.754f, 0.000f }, { 0.754f, 0.000f }, { 0.754f, 0.000f }, { 0.826f, 0.000f }, { 0.913f, 0.000f }, { 0.913f, 0.000f } },
+		},
+		{ // LifStatRange80
+			{ { 0.000f, 77.722f }, { 0.000f, 6.190f }, { 0.000f, 0.582f }, { 0.000f, 0.582f }, { 0.000f, 0.582f }, { 0.000f, 0.608f }, { 0.000f, 0.696f }, { 0.000f, 0.696f } },
+			{ { 77.722f, 78.228f }, { 6.190f, 6.266f }, { 0.582f, 0.595f }, { 0.582f, 0.595f }, { 0.582f, 0.595f }, { 0.608f, 0.620f }, { 0.696f, 0.722f }, { 0.696f, 0.722f } },
+			{ { 78.228f, 78.861f }, { 6.266f, 6.342f }, { 0.595f, 0.620f }, { 0.595f, 0.620f }, { 0.595f, 0.620f }, { 0.620f, 0.646f }, { 0.722f, 0.747f }, { 0.722f, 0.747f } },
+			{ { 78.861f, 79.620f }, { 6.342f, 6.456f }, { 0.620f, 0.658f }, { 0.620f, 0.658f }, { 0.620f, 0.658f }, { 0.646f, 0.684f }, { 0.747f, 0.785f }, { 0.747f, 0.785f } },
+			{ { 79.620f, 80.253f }, { 6.456f, 6.544f }, { 0.658f, 0.684f }, { 0.658f, 0.684f }, { 0.658f, 0.684f }, { 0.684f, 0.722f }, { 0.785f, 0.810f }, { 0.785f, 0.810f } },
+			{ { 80.253f, 81.013f }, { 6.544f, 6.658f }, { 0.684f, 0.709f }, { 0.684f, 0.709f }, { 0.684f, 0.709f }, { 0.722f, 0.759f }, { 0.810f, 0.848f }, { 0.810f, 0.848f } },
+			{ { 81.013f, 81.646f }, { 6.658f, 6.734f }, { 0.709f, 0.734f }, { 0.709f, 0.734f }, { 0.709f, 0.734f }, { 0.759f, 0.785f }, { 0.848f, 0.873f }, { 0.848f, 0.873f } },
+			{ { 81.646f, 82.152f }, { 6.734f, 6.810f }, { 0.734f, 0.747f }, { 0.734f, 0.747f }, { 0.734f, 0.747f }, { 0.785f, 0.810f }, { 0.873f, 0.899f }, { 0.873f, 0.899f } },
+			{ { 82.152f, 0.000f }, { 6.810f, 0.000f }, { 0.747f, 0.000f }, { 0.747f, 0.000f }, { 0.747f, 0.000f }, { 0.810f, 0.000f }, { 0.899f, 0.000f }, { 0.899f, 0.000f } },
+		},
+		{ // LifStatRange90
+			{ { 0.000f, 77.865f }, { 0.000f, 6.213f }, { 0.000f, 0.584f }, { 0.000f, 0.584f }, { 0.000f, 0.584f }, { 0.000f, 0.607f }, { 0.000f, 0.708f }, { 0.000f, 0.708f } },
+			{ { 77.865f, 78.315f }, { 6.213f, 6.270f }, { 0.584f, 0.607f }, { 0.584f, 0.607f }, { 0.584f, 0.607f }, { 0.607f, 0.629f }, { 0.708f, 0.730f }, { 0.708f, 0.730f } },
+			{ { 78.315f, 78.876f }, { 6.270f, 6.348f }, { 0.607f, 0.629f }, { 0.607f, 0.629f }, { 0.607f, 0.629f }, { 0.629f, 0.652f }, { 0.730f, 0.753f }, { 0.730f, 0.753f } },
+			{ { 78.876f, 79.663f }, { 6.348f, 6.461f }, { 0.629f, 0.652f }, { 0.629f, 0.652f }, { 0.629f, 0.652f }, { 0.652f, 0.685f }, { 0.753f, 0.787f }, { 0.753f, 0.787f } },
+			{ { 79.663f, 80.225f }, { 6.461f, 6.551f }, { 0.652f, 0.685f }, { 0.652f, 0.685f }, { 0.652f, 0.685f }, { 0.685f, 0.719f }, { 0.787f, 0.809f }, { 0.787f, 0.820f } },
+			{ { 80.225f, 81.011f }, { 6.551f, 6.652f }, { 0.685f, 0.708f }, { 0.685f, 0.708f }, { 0.685f, 0.708f }, { 0.719f, 0.753f }, { 0.809f, 0.843f }, { 0.820f, 0.843f } },
+			{ { 81.011f, 81.573f }, { 6.652f, 6.719f }, { 0.708f, 0.730f }, { 0.708f, 0.730f }, { 0.708f, 0.730f }, { 0.753f, 0.787f }, { 0.843f, 0.876f }, { 0.843f, 0.876f } },
+			{ { 81.573f, 82.022f }, { 6.719f, 6.787f }, { 0.730f, 0.742f }, { 0.730f, 0.742f }, { 0.730f, 0.742f }, { 0.787f, 0.809f }, { 0.876f, 0.899f }, { 0.876f, 0.888f } },
+			{ { 82.022f, 0.000f }, { 6.787f, 0.000f }, { 0.742f, 0.000f }, { 0.742f, 0.000f }, { 0.742f, 0.000f }, { 0.809f, 0.000f }, { 0.899f, 0.000f }, { 0.888f, 0.000f } },
+		},
+		{ // LifStatRange99
+			{ { 0.000f, 77.959f }, { 0.000f, 6.224f }, { 0.000f, 0.592f }, { 0.000f, 0.592f }, { 0.000f, 0.592f }, { 0.000f, 0.612f }, { 0.000f, 0.714f }, { 0.000f, 0.714f } },
+			{ { 77.959f, 78.367f }, { 6.224f, 6.286f }, { 0.592f, 0.602f }, { 0.592f, 0.602f }, { 0.592f, 0.602f }, { 0.612f, 0.633f }, { 0.714f, 0.735f }, { 0.714f, 0.735f } },
+			{ { 78.367f, 78.980f }, { 6.286f, 6.357f }, { 0.602f, 0.622f }, { 0.602f, 0.622f }, { 0.602f, 0.622f }, { 0.633f, 0.653f }, { 0.735f, 0.755f }, { 0.735f, 0.755f } },
+			{ { 78.980f, 79.694f }, { 6.357f, 6.459f }, { 0.622f, 0.653f }, { 0.622f, 0.653f }, { 0.622f, 0.653f }, { 0.653f, 0.694f }, { 0.755f, 0.786f }, { 0.755f, 0.786f } },
+			{ { 79.694f, 80.306f }, { 6.459f, 6.541f }, { 0.653f, 0.684f }, { 0.653f, 0.684f }, { 0.653f, 0.684f }, { 0.694f, 0.724f }, { 0.786f, 0.816f }, { 0.786f, 0.816f } },
+			{ { 80.306f, 80.918f }, { 6.541f, 6.643f }, { 0.684f, 0.704f }, { 0.684f, 0.704f }, { 0.684f, 0.704f }, { 0.724f, 0.755f }, { 0.816f, 0.847f }, { 0.816f, 0.847f } },
+			{ { 80.918f, 81.429f }, { 6.643f, 6.714f }, { 0.704f, 0.724f }, { 0.704f, 0.724f }, { 0.704f, 0.724f }, { 0.755f, 0.776f }, { 0.847f, 0.867f }, { 0.847f, 0.867f } },
+			{ { 81.429f, 81.837f }, { 6.714f, 6.776f }, { 0.724f, 0.745f }, { 0.724f, 0.745f }, { 0.724f, 0.745f }, { 0.776f, 0.806f }, { 0.867f, 0.888f }, { 0.867f, 0.888f } },
+			{ { 81.837f, 0.000f }, { 6.776f, 0.000f }, { 0.745f, 0.000f }, { 0.745f, 0.000f }, { 0.745f, 0.000f }, { 0.806f, 0.000f }, { 0.888f, 0.000f }, { 0.888f, 0.000f } },
+		},
+	},
+};
+
+// get_stat_rank as it was: the first rank whose range holds the value. Abysmal is
+// anything below its max and Amazing anything above its min, a value no range holds
+// falls back to Abysmal.
+static StatRank baseline_get_stat_rank(float value, StatType stat, const float ranges[RANK_COUNT][STAT_COUNT][2])
+{
+	int i;
+
+	for (i = 0; i < RANK_COUNT; i++) {
+		float min = ranges[i][stat][0], max = ranges[i][stat][1];
+
+		if (i == RANK_ABYSMAL && value < max)
+			return RANK_ABYSMAL;
+		else if (i == RANK_AMAZING && value > min)
+			return RANK_AMAZING;
+		else if (value >= min && value <= max)
+			return (StatRank)i;
+	}
+
+	return RANK_ABYSMAL; // fallback if no range matched
+}
+
+#endif /* HOMGROWTH_BASELINE_H */
@@ -0,0 +1,224 @@
+//===== Plugin tests =========================================
+//= homgrowth_rank_test.c
+//===== Description: =========================================
+//= @homgrowth.c: ranks every growth a homunculus can have at
+//= every level with get_all_stat_ranks and with the classifier
+//= it replaced (homgrowth_baseline.h), checks
+//= homgrowth_parse_milli, then times both classifiers.
+//===== Additional Comments: =================================
+//= The plugin is included, so its static functions can be
+//= called, and linked with the stand-in server of bench/.
+//= Exits with 1 on any unexpected difference.
+//============================================================
+#include "bench.h"
+
+#include "@homgrowth.c"
+#include "homgrowth_baseline.h"
+
+#define LEVEL_MAX 99 // Last level of the growth sheets
+#define REPORT_MAX 20 // Differences printed
+
+struct rank_counts {
+	uint64 cases;
+	uint64 gap; // Vanilmirth 71-80 Agi above 1.253 and up to 1.266
+	uint64 unexpected;
+};
+
+static int failures = 0;
+
+// The only fix the threshold arrays made: the baseline's Vanilmirth 71-80 Excellent Agi
+// stopped at 1.253 instead of the sheet's 1.266, and what fell in between was Abysmal.
+static bool expected_difference(int type, int band, int stat, int gain, int levels, float value, StatRank old, StatRank now)
+{
+	return type == BASELINE_VANILMIRTH && band == 7 && stat == STAT_AGI && old == RANK_ABYSMAL && now == RANK_EXCELLENT
+	    && value > 1.253f && (int64)gain * HOMGROWTH_SCALE <= (int64)1266 * levels;
+}
+
+// Every level of every type, every gain from below nothing to a quarter above Amazing
+static void test_equivalence(void)
+{
+	struct rank_counts counts = { 0 };
+	int type;
+
+	for (type = 0; type < BASELINE_TYPES; type++) {
+		const struct homgrowth_type *sheet = homgrowth_find_type(&homgrowth_data, baseline_type_names[type]);
+		int level;
+
+		if (sheet == NULL) {
+			printf("FAIL: no '%s' sheet in %s/%s\n", baseline_type_names[type], map->db_path, HOMGROWTH_DB);
+			failures++;
+			continue;
+		}
+		for (level = 2; level <= LEVEL_MAX; level++) {
+			int band = homgrowth_band(level), levels = level - 1;
+			const StatThresholds *t = &sheet->thresholds[band];
+			int hi[STAT_COUNT], top = 0, gain, stat;
+
+			for (stat = 0; stat < STAT_COUNT; stat++) {
+				hi[stat] = (int)((int64)t->thresholds[stat][RANK_COUNT - 2] * levels * 5 / 4 / HOMGROWTH_SCALE) + levels + 1;
+				top = max(top, hi[stat]);
+			}
+			for (gain = -levels; gain <= top; gain++) {
+				const int gains[STAT_COUNT] = { gain, gain, gain, gain, gain, gain, gain, gain };
+				float value = (float)((double)gain / levels); // As the baseline @homgrowth computed it
+				StatRank ranks[STAT_COUNT];
+
+				get_all_stat_ranks(gains, levels, t, ranks);
+				for (stat = 0; stat < STAT_COUNT; stat++) {
+					StatRank old;
+
+					if (gain > hi[stat])
+						continue;
+					counts.cases++;
+					old = baseline_get_stat_rank(value, (StatType)stat, baseline_ranges[type][band]);
+					if (old == ranks[stat])
+						continue;
+					if (expected_difference(type, band, stat, gain, levels, value, old, ranks[stat])) {
+						counts.gap++;
+						continue;
+					}
+					if (++counts.unexpected <= REPORT_MAX)
+						printf("FAIL: %s Lv %d %s, %d over %d levels (%.6f): baseline %s, now %s\n", baseline_type_names[type], level, homgrowth_stat_names[stat],
+						       gain, levels, value, get_rank_name(old), get_rank_name(ranks[stat]));
+				}
+			}
+		}
+	}
+	printf("get_all_stat_ranks: %"PRIu64" growths, %"PRIu64" in the Vanilmirth Agi gap, %"PRIu64" unexpected differences\n",
+	       counts.cases, counts.gap, counts.unexpected);
+	if (counts.unexpected > 0 || counts.gap == 0)
+		failures++;
+}
+
+static void test_parse_milli(void)
+{
+	static const struct {
+		const char *str;
+		bool valid;
+		int value;
+	} cases[] = {
+		{ "1", true, 1000 },
+		{ "1.5", true, 1500 },
+		{ "0.667", true, 667 },
+		{ "108.889", true, 108889 },
+		{ "  2.3", true, 2300 },
+		{ "4.", true, 4000 },
+		{ "+2", true, 2000 },
+		{ "-0.25", true, -250 },
+		{ "2147483.647", true, INT_MAX },
+		{ "1.2345", false, 0 },
+		{ "2147483.648", false, 0 },
+		{ "2147484", false, 0 },
+		{ "99999999999", false, 0 },
+		{ "", false, 0 },
+		{ ".5", false, 0 },
+		{ "-", false, 0 },
+		{ "abc", false, 0 },
+		{ "1.2.3", false, 0 },
+		{ "1,5", false, 0 },
+	};
+	int i, bad = 0;
+
+	for (i = 0; i < ARRAYLENGTH(cases); i++) {
+		int value = 0;
+		bool valid = homgrowth_parse_milli(cases[i].str, &value);
+
+		if (valid != cases[i].valid || (valid && value != cases[i].value)) {
+			printf("FAIL: homgrowth_parse_milli(\"%s\") gave %s %d, expected %s %d\n", cases[i].str,
+			       valid ? "valid" : "invalid", value, cases[i].valid ? "valid" : "invalid", cases[i].value);
+			bad++;
+		}
+	}
+	printf("homgrowth_parse_milli: %d strings, %d wrong\n", (int)ARRAYLENGTH(cases), bad);
+	if (bad > 0)
+		failures++;
+}
+
+// Reports made of random homunculi: one get_all_stat_ranks against eight baseline calls
+#define SAMPLE_COUNT 4096
+
+struct rank_sample {
+	int type;
+	int band;
+	int levels;
+	int gains[STAT_COUNT];
+};
+
+static void test_speed(int passes)
+{
+	static struct rank_sample samples[SAMPLE_COUNT];
+	const StatThresholds *thresholds[BASELINE_TYPES];
+	unsigned int seed = 20190530;
+	uint64 start, ns_old, ns_now, sum_old = 0, sum_now = 0;
+	int i, pass, stat;
+
+	for (i = 0; i < BASELINE_TYPES; i++) {
+		const struct homgrowth_type *sheet = homgrowth_find_type(&homgrowth_data, baseline_type_names[i]);
+
+		if (sheet == NULL)
+			return;
+		thresholds[i] = sheet->thresholds;
+	}
+	for (i = 0; i < SAMPLE_COUNT; i++) {
+		struct rank_sample *s = &samples[i];
+		int level;
+
+		seed = seed * 1103515245 + 12345;
+		s->type = (seed >> 16) % BASELINE_TYPES;
+		seed = seed * 1103515245 + 12345;
+		level = 2 + (seed >> 16) % (LEVEL_MAX - 1);
+		s->band = homgrowth_band(level);
+		s->levels = level - 1;
+		for (stat = 0; stat < STAT_COUNT; stat++) {
+			int amazing = thresholds[s->type][s->band].thresholds[stat][RANK_COUNT - 2];
+
+			seed = seed * 1103515245 + 12345;
+			s->gains[stat] = (int)((int64)((seed >> 8) % (amazing * 5 / 4 + 1)) * s->levels / HOMGROWTH_SCALE);
+		}
+	}
+
+	start = bench_now();
+	for (pass = 0; pass < passes; pass++) {
+		for (i = 0; i < SAMPLE_COUNT; i++) {
+			const struct rank_sample *s = &samples[i];
+
+			for (stat = 0; stat < STAT_COUNT; stat++)
+				sum_old += baseline_get_stat_rank((float)((double)s->gains[stat] / s->levels), (StatType)stat, baseline_ranges[s->type][s->band]);
+		}
+	}
+	ns_old = bench_now() - start;
+
+	start = bench_now();
+	for (pass = 0; pass < passes; pass++) {
+		for (i = 0; i < SAMPLE_COUNT; i++) {
+			const struct rank_sample *s = &samples[i];
+			StatRank ranks[STAT_COUNT];
+
+			get_all_stat_ranks(s->gains, s->levels, &thresholds[s->type][s->band], ranks);
+			for (stat = 0; stat < STAT_COUNT; stat++)
+				sum_now += ranks[stat];
+		}
+	}
+	ns_now = bench_now() - start;
+
+	bench_header("8 stats of a homunculus ranked");
+	bench_result("baseline get_stat_rank x8", (uint64)passes * SAMPLE_COUNT, ns_old);
+	bench_result("get_all_stat_ranks", (uint64)passes * SAMPLE_COUNT, ns_now);
+	// The sums keep the loops from being optimized out, they differ where the ranks do
+	bench_note("rank sums %"PRIu64" and %"PRIu64, sum_old, sum_now);
+}
+
+int main(int argc, char **argv)
+{
+	bench_init(argc, argv);
+	if (!homgrowth_read_db())
+		return EXIT_FAILURE;
+
+	test_parse_milli();
+	test_equivalence();
+	test_speed(bench_scale(500));
+
+	homgrowth_db_clear(&homgrowth_data);
+	printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,230 @@
+//===== Plugin tests =========================================
+//= homgrowth_table_test.c
+//===== Description: =========================================
+//= @homgrowth.c: ranks every gain at every level of every
+//= homunculus class listed in db/homgrowth_db.txt and compares
+//= it with the threshold table of the file, read here on its
+//= own, and with the float ranking the integer one replaced.
+//===== Additional Comments: =================================
+//= The plugin is included, so its static functions can be
+//= called, and linked with the stand-in server of bench/.
+//= Exits with 1 on any difference.
+//============================================================
+#include "bench.h"
+
+#include "@homgrowth.c"
+
+#define LEVEL_MAX 99 // Last level of the growth sheets
+#define TYPE_MAX 8
+#define CLASS_MAX 32
+#define REPORT_MAX 20 // Differences printed
+
+// A threshold as written in the file: num / 10^decimals
+struct table_threshold {
+	int64 num;
+	int64 den;
+	float value; // strtof of the text, what the float ranking used
+};
+
+struct table_type {
+	char name[NAME_LENGTH];
+	int base[STAT_COUNT];
+	struct table_threshold thresholds[HOMGROWTH_BANDS][STAT_COUNT][RANK_COUNT - 1];
+};
+
+static struct table_type table_types[TYPE_MAX];
+static int table_type_count = 0;
+static struct {
+	int class_;
+	int type;
+} table_classes[CLASS_MAX];
+static int table_class_count = 0;
+static int failures = 0;
+
+static struct table_type *table_find_type(const char *name)
+{
+	int i;
+
+	ARR_FIND(0, table_type_count, i, strcmp(table_types[i].name, name) == 0);
+	return i < table_type_count ? &table_types[i] : NULL;
+}
+
+static bool table_parse(const char *str, struct table_threshold *out)
+{
+	const char *p = str;
+	int64 num = 0, den = 1;
+	bool fraction = false;
+
+	for (; *p != '\0'; p++) {
+		if (*p == '.' && !fraction) {
+			fraction = true;
+			continue;
+		}
+		if (*p < '0' || *p > '9')
+			return false;
+		num = num * 10 + (*p - '0');
+		if (fraction)
+			den *= 10;
+	}
+	out->num = num;
+	out->den = den;
+	out->value = strtof(str, NULL);
+	return true;
+}
+
+// Reads the Type and threshold lines, without the plugin's loader
+static bool table_read(const char *path)
+{
+	char line[1024];
+	FILE *fp;
+	int rows = 0;
+
+	if ((fp = fopen(path, "r")) == NULL) {
+		printf("FAIL: cannot open %s\n", path);
+		return false;
+	}
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		char *fields[3 + STAT_COUNT], *p;
+		int n = 0, i;
+
+		if (line[0] == '/' || line[0] == '\r' || line[0] == '\n')
+			continue;
+		for (p = strtok(line, ",\r\n"); p != NULL && n < ARRAYLENGTH(fields); p = strtok(NULL, ",\r\n"))
+			fields[n++] = p;
+		if (n != ARRAYLENGTH(fields))
+			continue;
+
+		if (strcmp(fields[0], "Type") == 0) {
+			struct table_type *type = &table_types[table_type_count++];
+
+			safestrncpy(type->name, fields[1], sizeof(type->name));
+			for (i = 0; i < STAT_COUNT; i++)
+				type->base[i] = atoi(fields[3 + i]);
+			for (p = strtok(fields[2], ":"); p != NULL; p = strtok(NULL, ":")) {
+				table_classes[table_class_count].class_ = atoi(p);
+				table_classes[table_class_count++].type = table_type_count - 1;
+			}
+		} else {
+			struct table_type *type = table_find_type(fields[0]);
+			int label = atoi(fields[1]), band = label == 99 ? HOMGROWTH_BANDS - 1 : label / 10 - 1, stat;
+
+			ARR_FIND(0, STAT_COUNT, stat, strcmp(homgrowth_stat_names[stat], fields[2]) == 0);
+			if (type == NULL || stat == STAT_COUNT) {
+				printf("FAIL: unexpected line '%s,%s,%s'\n", fields[0], fields[1], fields[2]);
+				fclose(fp);
+				return false;
+			}
+			for (i = 0; i < RANK_COUNT - 1; i++) {
+				if (!table_parse(fields[3 + i], &type->thresholds[band][stat][i])) {
+					printf("FAIL: unexpected threshold '%s'\n", fields[3 + i]);
+					fclose(fp);
+					return false;
+				}
+			}
+			rows++;
+		}
+	}
+	fclose(fp);
+	printf("%s: %d types, %d classes, %d threshold rows\n", HOMGROWTH_DB, table_type_count, table_class_count, rows);
+	return rows == table_type_count * HOMGROWTH_BANDS * STAT_COUNT;
+}
+
+// The plugin must resolve each class to the sheet the file gives it, with the same
+// starting stats, and hold every threshold of the file exactly
+static void test_sheets(void)
+{
+	int i, band, stat, k, bad = 0;
+
+	for (i = 0; i < table_class_count; i++) {
+		const struct table_type *expected = &table_types[table_classes[i].type];
+		const struct homgrowth_type *type = homgrowth_type(table_classes[i].class_);
+
+		if (type == NULL || strcmp(type->name, expected->name) != 0 || memcmp(type->base, expected->base, sizeof(type->base)) != 0) {
+			printf("FAIL: class %d is not read as %s\n", table_classes[i].class_, expected->name);
+			bad++;
+			continue;
+		}
+		for (band = 0; band < HOMGROWTH_BANDS; band++) {
+			for (stat = 0; stat < STAT_COUNT; stat++) {
+				for (k = 0; k < RANK_COUNT - 1; k++) {
+					const struct table_threshold *t = &expected->thresholds[band][stat][k];
+
+					if ((int64)type->thresholds[band].thresholds[stat][k] * t->den != t->num * HOMGROWTH_SCALE) {
+						printf("FAIL: %s band %d %s threshold %d is %d thousandths, the file has %"PRId64"/%"PRId64"\n", expected->name, band,
+						       homgrowth_stat_names[stat], k, type->thresholds[band].thresholds[stat][k], t->num, t->den);
+						bad++;
+					}
+				}
+			}
+		}
+	}
+	printf("growth sheets: %d classes, %d differences\n", table_class_count, bad);
+	if (bad > 0)
+		failures++;
+}
+
+// Every class, level 2 to 99 and stat, every gain from below nothing to a quarter above Amazing.
+// The rank is the number of thresholds the growth per level is above: gains / levels > num / den.
+static void test_ranks(void)
+{
+	uint64 cases = 0, exact_diffs = 0, float_diffs = 0;
+	int i;
+
+	for (i = 0; i < table_class_count; i++) {
+		const struct table_type *table = &table_types[table_classes[i].type];
+		const struct homgrowth_type *type = homgrowth_type(table_classes[i].class_);
+		int level;
+
+		if (type == NULL)
+			continue; // Reported by test_sheets
+		for (level = 2; level <= LEVEL_MAX; level++) {
+			int band = min(level / 10, HOMGROWTH_BANDS - 1), levels = level - 1, stat;
+
+			for (stat = 0; stat < STAT_COUNT; stat++) {
+				const struct table_threshold *t = table->thresholds[band][stat];
+				int hi = (int)(t[RANK_COUNT - 2].num * levels * 5 / 4 / t[RANK_COUNT - 2].den) + levels + 1, gain;
+
+				for (gain = -levels; gain <= hi; gain++) {
+					int gains[STAT_COUNT] = { 0 };
+					StatRank ranks[STAT_COUNT];
+					float value = (float)((double)gain / levels);
+					int exact = 0, old = 0, k;
+
+					gains[stat] = gain;
+					get_all_stat_ranks(gains, levels, &type->thresholds[homgrowth_band(level)], ranks);
+					for (k = 0; k < RANK_COUNT - 1; k++) {
+						exact += ((int64)gain * t[k].den > t[k].num * levels);
+						old += (value > t[k].value);
+					}
+					cases++;
+					if ((int)ranks[stat] != exact && ++exact_diffs <= REPORT_MAX)
+						printf("FAIL: class %d Lv %d %s, %d over %d levels: rank %d, the table gives %d\n", table_classes[i].class_, level,
+						       homgrowth_stat_names[stat], gain, levels, (int)ranks[stat], exact);
+					if ((int)ranks[stat] != old && ++float_diffs <= REPORT_MAX)
+						printf("FAIL: class %d Lv %d %s, %d over %d levels: rank %d, the float ranking gave %d\n", table_classes[i].class_, level,
+						       homgrowth_stat_names[stat], gain, levels, (int)ranks[stat], old);
+				}
+			}
+		}
+	}
+	printf("get_all_stat_ranks: %"PRIu64" growths, %"PRIu64" differences with the table, %"PRIu64" with the float ranking\n", cases, exact_diffs, float_diffs);
+	if (cases == 0 || exact_diffs > 0 || float_diffs > 0)
+		failures++;
+}
+
+int main(int argc, char **argv)
+{
+	char path[1024];
+
+	bench_init(argc, argv);
+	snprintf(path, sizeof(path), "%s/%s", map->db_path, HOMGROWTH_DB);
+	if (!table_read(path) || !homgrowth_read_db())
+		return EXIT_FAILURE;
+
+	test_sheets();
+	test_ranks();
+
+	homgrowth_db_clear(&homgrowth_data);
+	printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}